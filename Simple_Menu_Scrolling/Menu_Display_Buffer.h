@@ -0,0 +1,142 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Display_Buffer.h: Display backend that keeps the menu as text in memory. Nothing is drawn anywhere, which
+| makes it useful for checking menus from code and for building the library away from the hardware.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef MENU_DISPLAY_BUFFER_H
+#define MENU_DISPLAY_BUFFER_H
+
+#include <string.h>
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// --------------------------- /    \   / ___/  / ___/  /_  _/  / \  / /  / ___/  / ____/ ----------------------------- //
+// -------------------------- / /_\ /  / __/   / __/     / /   / /\\/ /  / __/    \__ \  ------------------------------ //
+// ------------------------- /_____/  /____/  /_/      /___/  /_/  \_/  /____/  /_____/ ------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+// Characters held for each line of the buffer, including the selection marker
+#define BUFFER_COLS     (MAX_CHAR + 1)
+
+// The text is held inside menuDisplay, nothing else is used
+#define DISPLAY_RAM     0
+
+// Each character counts as one unit of width. Labels get every column after the marker
+#define CHAR_WIDTH      1
+#define LABEL_CHARS     (BUFFER_COLS - 1)
+
+// Text has no pixels to draw icons in, so they take no room from the label
+#define ICON_CHARS      0
+
+/*  ---------------------------------------------------------------------------------------------------------------------/ 
+|  ------------------------------------------------ DISPLAY CLASS ------------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuDisplay: Stores the menu title in line 0 and each node row in the lines below it, as null terminated strings.
+| The selection marker is the first character of each node line.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuDisplay
+{
+  public:
+
+  // The text of the screen, title first
+  char text[MAX_ITEMS + 1][BUFFER_COLS + 1];
+
+  // Counts how many frames have been flushed
+  unsigned long frames = 0;
+
+  // Set while the display is dimmed or asleep
+  char dimmed = 0;
+  char asleep = 0;
+
+  void clear()
+  {
+    memset(text, 0, sizeof(text));
+  }
+
+  void title(char * name)
+  {
+    strncpy(text[0], name, BUFFER_COLS);
+  }
+
+  void row(char index, char selected, const char * label, unsigned char offset, menuIcon, char)
+  {
+    text[index + 1][0] = ROW_MARKS[(unsigned char) selected];
+    strncpy(&text[index + 1][1], label + offset, LABEL_CHARS);
+  }
+
+  // Writes a value right aligned at the end of a row. Gaps left after a short label are filled with spaces so the
+  // line still reads as one string
+  void digits(char index, char * text, char *)
+  {
+    char * line = this->text[index + 1];
+
+    for(unsigned char i = 0; i < BUFFER_COLS - VALUE_CHARS; i++)
+    {
+      if(!line[i])
+      {
+        line[i] = ' ';
+      }
+    }
+
+    memcpy(&line[BUFFER_COLS - VALUE_CHARS], text, VALUE_CHARS);
+  }
+
+  void flush()
+  {
+    frames++;
+  }
+
+  void flushRow(char)
+  {
+    frames++;
+  }
+
+  char update()
+  {
+    return 0;
+  }
+
+  // Every frame is written in full, there is nothing to invalidate
+  void invalidate()
+  {
+  }
+
+  char busy()
+  {
+    return 0;
+  }
+
+  // The text lines, for reading back what is on screen
+  const unsigned char * buffer()
+  {
+    return (const unsigned char *) text;
+  }
+
+  unsigned short bufferSize()
+  {
+    return sizeof(text);
+  }
+
+  void dim(char on)
+  {
+    dimmed = on;
+  }
+
+  void sleep(char on)
+  {
+    asleep = on;
+  }
+};
+
+#endif
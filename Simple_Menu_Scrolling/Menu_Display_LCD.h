@@ -0,0 +1,150 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Display_LCD.h: Display backend for HD44780 character LCDs driven through the LiquidCrystal library. The menu
+| name goes on the first line and the nodes on the lines below it.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef MENU_DISPLAY_LCD_H
+#define MENU_DISPLAY_LCD_H
+
+#include <LiquidCrystal.h>
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// --------------------------- /    \   / ___/  / ___/  /_  _/  / \  / /  / ___/  / ____/ ----------------------------- //
+// -------------------------- / /_\ /  / __/   / __/     / /   / /\\/ /  / __/    \__ \  ------------------------------ //
+// ------------------------- /_____/  /____/  /_/      /___/  /_/  \_/  /____/  /_____/ ------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+// Size of the character display. MAX_ITEMS should be at most LCD_ROWS - 1
+#define LCD_COLS        20
+#define LCD_ROWS        4
+
+// Each character counts as one unit of width. Labels get every column after the arrow
+#define CHAR_WIDTH      1
+#define LABEL_CHARS     (LCD_COLS - 1)
+
+// Icons are left out on character displays, so they take no room from the label
+#define ICON_CHARS      0
+
+// The LCD keeps its own memory, no RAM is used outside of menuDisplay
+#define DISPLAY_RAM     0
+
+/*  ---------------------------------------------------------------------------------------------------------------------/ 
+|  ------------------------------------------------ DISPLAY CLASS ------------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuDisplay: Writes the menu title and node rows to a character LCD. The LCD holds its own memory so there is no
+| frame to send; flush and update do nothing.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - lcd must be pointed at an initialized LiquidCrystal object before the first build
+| - Node icons aren't drawn. They could be loaded into the LCD's eight custom characters
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuDisplay
+{
+  public:
+
+  // The LiquidCrystal object for the screen
+  LiquidCrystal * lcd = NULL;
+
+  void clear()
+  {
+    lcd->clear();
+  }
+
+  void title(char * name)
+  {
+    lcd->setCursor(0, 0);
+    lcd->write(name);
+  }
+
+  // Writes the row from the label's character offset and pads it with spaces so a redraw covers the old text
+  void row(char index, char selected, const char * label, unsigned char offset, menuIcon, char)
+  {
+    lcd->setCursor(0, index + 1);
+    lcd->write(ROW_MARKS[(unsigned char) selected]);
+
+    label += offset;
+    for(unsigned char i = 0; i < LABEL_CHARS; i++)
+    {
+      lcd->write(*label ? *label++ : ' ');
+    }
+  }
+
+  // Writes a value right aligned at the end of a row, only the characters that differ from previous if it is given
+  void digits(char index, char * text, char * previous)
+  {
+    for(unsigned char i = 0; i < VALUE_CHARS; i++)
+    {
+      if(!previous || previous[i] != text[i])
+      {
+        lcd->setCursor(LCD_COLS - VALUE_CHARS + i, index + 1);
+        lcd->write(text[i]);
+      }
+    }
+  }
+
+  void flush()
+  {
+  }
+
+  void flushRow(char)
+  {
+  }
+
+  char update()
+  {
+    return 0;
+  }
+
+  // Every frame is written to the panel in full, there is nothing to invalidate
+  void invalidate()
+  {
+  }
+
+  char busy()
+  {
+    return 0;
+  }
+
+  // Nothing is kept to read back, the text only lives on the panel
+  const unsigned char * buffer()
+  {
+    return 0;
+  }
+
+  unsigned short bufferSize()
+  {
+    return 0;
+  }
+
+  // The HD44780 has no contrast control of its own, the backlight is wired outside of it
+  void dim(char)
+  {
+  }
+
+  void sleep(char on)
+  {
+    if(on)
+    {
+      lcd->noDisplay();
+    }
+
+    else
+    {
+      lcd->display();
+    }
+  }
+};
+
+// The title takes the first line, so only LCD_ROWS - 1 are left for nodes
+static_assert(MAX_ITEMS <= LCD_ROWS - 1, "MAX_ITEMS rows don't fit below the title; set MAX_ITEMS to LCD_ROWS - 1");
+
+#endif
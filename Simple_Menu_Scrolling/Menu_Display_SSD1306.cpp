@@ -0,0 +1,121 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Display_SSD1306.cpp: The parts of the SSD1306 backend that read the font: the character and row blits. See
+| Menu_Display_SSD1306.h. Only built when MENU_DISPLAY is DISPLAY_SSD1306.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#include "Simple_Menu_Scrolling.h"
+
+#if MENU_DISPLAY == DISPLAY_SSD1306
+
+#include <Arduino.h>
+
+// The 5x7 font the Adafruit GFX library draws text size 1 with, so rows blitted straight into the buffer look the same
+// as text drawn through the driver. Included here only, so there is one copy of it in flash
+#include <glcdfont.c>
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuDisplay::glyph: Copies one character into a page starting at column. A row is exactly one page, so each font
+| column is one buffer byte.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - uint8_t page, column: where the character's first column goes
+|
+| - char c: the character
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the column the next character goes at
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Like Adafruit GFX, characters 176 and up are moved along one place in the font unless cp437 is set, since the
+|   font has an extra character there
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+uint8_t menuDisplay::glyph(uint8_t page, uint8_t column, char c)
+{
+    uint8_t index = c;
+
+    if(!this->cp437 && index >= 176)
+    {
+        index++;
+    }
+
+    const unsigned char * columns = font + index * GLYPH_COLUMNS;
+
+    for(uint8_t i = 0; i < GLYPH_COLUMNS; i++)
+    {
+        this->put(page, column++, pgm_read_byte(columns + i));
+    }
+
+    this->put(page, column++, 0);
+    return column;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuDisplay::row: Draws one node row below the title, with an arrow if it is selected (a star while its value is
+| edited). The rest of the row is blanked so it can be redrawn on its own, and the label is shown from character offset
+| onwards, cut off at the edge of the screen or at the value. The row is one page of the buffer, so it is written directly a column at
+| a time instead of going through the driver's character drawing.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - char index: the row, 0 being the first below the title
+|
+| - char selected: the ROW_MARKS index of the marker drawn in front
+|
+| - const char * label, unsigned char offset: the label and the number of characters it is scrolled by
+|
+| - menuIcon icon: the node's icon, or NULL
+|
+| - char value: whether digits() draws a value at the end of the row (a NUM node)
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - An icon is unpacked from flash straight into the row after the arrow, ICON_WIDTH columns of it
+| - The value's columns are left to digits(). Blanking them here would only have them drawn again, and every NUM row
+|   would send its value to the panel on each frame
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuDisplay::row(char index, char selected, const char * label, unsigned char offset, menuIcon icon, char value)
+{
+    uint8_t page = TITLE_HEIGHT / 8 + index;
+    uint8_t end = value ? VALUE_COLUMN : OLED_WIDTH;
+    uint8_t column = this->glyph(page, 0, ROW_MARKS[(unsigned char) selected]);
+    unsigned char chars = LABEL_CHARS;
+
+    if(icon)
+    {
+        menuIconReader reader(icon);
+
+        for(uint8_t i = 0; i < ICON_WIDTH; i++)
+        {
+            this->put(page, column++, reader.next());
+        }
+
+        chars = LABEL_CHARS - ICON_CHARS;
+    }
+
+    label += offset;
+    for(unsigned char i = 0; i < chars && label[i] && column + CHAR_WIDTH <= end; i++)
+    {
+        column = this->glyph(page, column, label[i]);
+    }
+
+    while(column < end)
+    {
+        this->put(page, column++, 0);
+    }
+
+    this->rowsDrawn |= 1 << index;
+}
+
+#endif
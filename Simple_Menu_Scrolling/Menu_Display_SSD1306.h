@@ -0,0 +1,339 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Display_SSD1306.h: Display backend for SSD1306 OLED screens driven through the Adafruit library set up in
+| OLED_Tools.h. The frame buffer is sent over I2C a chunk at a time, so the main loop is held for one FLUSH_CHUNK
+| transmission at a time instead of the whole frame. Each transmission still blocks; there is no interrupt or DMA
+| driven transfer.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef MENU_DISPLAY_SSD1306_H
+#define MENU_DISPLAY_SSD1306_H
+
+#include "OLED_Tools.h"
+#include <Wire.h>
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// --------------------------- /    \   / ___/  / ___/  /_  _/  / \  / /  / ___/  / ____/ ----------------------------- //
+// -------------------------- / /_\ /  / __/   / __/     / /   / /\\/ /  / __/    \__ \  ------------------------------ //
+// ------------------------- /_____/  /____/  /_/      /___/  /_/  \_/  /____/  /_____/ ------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+// Display geometry and bus settings used for the non-blocking flush
+#define OLED_ADDRESS    0x3C
+#define OLED_WIDTH      128
+#define OLED_HEIGHT     64
+#define FLUSH_CHUNK     16
+#define OLED_PAGES      (OLED_HEIGHT / 8)
+
+// Pixel height of the menu title (text size 2) and of each node row (text size 1)
+#define TITLE_HEIGHT    16
+#define ROW_HEIGHT      8
+
+// Width of a text size 1 character and the number of label characters that fit on a row after the arrow. Each
+// character is 5 font columns and a blank one
+#define CHAR_WIDTH      6
+#define GLYPH_COLUMNS   5
+#define LABEL_CHARS     (OLED_WIDTH / CHAR_WIDTH - 1)
+
+// First column of the value digits() draws at the end of a NUM row
+#define VALUE_COLUMN    (OLED_WIDTH - VALUE_CHARS * CHAR_WIDTH)
+
+// Columns of a node icon, drawn between the arrow and the label, and the label characters it costs
+#define ICON_WIDTH      8
+#define ICON_CHARS      (LABEL_CHARS - (OLED_WIDTH - CHAR_WIDTH - ICON_WIDTH) / CHAR_WIDTH)
+
+// Node rows that fit below the title
+#define OLED_ROWS       ((OLED_HEIGHT - TITLE_HEIGHT) / ROW_HEIGHT)
+
+// The frame buffer the Adafruit driver allocates, which is not part of menuDisplay itself
+#define DISPLAY_RAM     (OLED_WIDTH * OLED_HEIGHT / 8)
+
+/*  ---------------------------------------------------------------------------------------------------------------------/ 
+|  ------------------------------------------------ DISPLAY CLASS ------------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuDisplay: Draws the menu title and node rows into the SSD1306 frame buffer and streams the buffer to the screen.
+| Most functions are inline so the menu engine calls straight into the driver; the character and row blits that read
+| the font live in Menu_Display_SSD1306.cpp, so the font is in flash once. Once sent, the buffer holds what the panel
+| shows, so each byte written is compared with the one already there and only the columns that changed on each page are
+| sent. Moving the arrow sends a few bytes instead of the whole kilobyte.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - oled and address can be changed to drive a second panel
+| - Rows and values are written straight into the frame buffer, so the panel has to be used unrotated
+| - Anything drawn on the buffer outside this class isn't tracked, call invalidate() (menuFrame::redraw) after it
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuDisplay
+{
+  public:
+
+  // The driver object and I2C address of the panel
+  Adafruit_SSD1306 * oled = &oledDisplay;
+  uint8_t address = OLED_ADDRESS;
+
+  // First and last column of each page changed since it was last sent. Clean pages have first at OLED_WIDTH and last
+  // at 0
+  uint8_t dirtyFirst[OLED_PAGES];
+  uint8_t dirtyLast[OLED_PAGES];
+
+  // The title last drawn, so an unchanged title isn't drawn or sent again
+  char titleText[MAX_CHAR];
+
+  // The rows drawn since clear(), so flush() can blank the rest
+  uint8_t rowsDrawn = 0;
+  char cleared = 0;
+
+  // While a flush is in progress: the page being sent and the last page to send, and the columns of the page still to
+  // go once its address window is open
+  uint8_t flushPage = 0;
+  uint8_t flushLast = 0;
+  uint8_t sendFrom = 0;
+  uint8_t sendTo = 0;
+  char windowOpen = 0;
+
+  // Set while the frame buffer is being sent. The frame is locked until it clears
+  char flushBusy = 0;
+
+  // Set if the driver was switched to the full code page with oled->cp437(true), so blitted characters 176 and up
+  // match the ones it draws
+  char cp437 = 0;
+
+  // Nothing has been sent yet, so every page starts out changed
+  menuDisplay()
+  {
+    invalidate();
+  }
+
+  // Marks the whole panel as changed, so the next flush sends every page and the title is drawn again
+  void invalidate()
+  {
+    memset(dirtyFirst, 0, sizeof(dirtyFirst));
+    memset(dirtyLast, OLED_WIDTH - 1, sizeof(dirtyLast));
+    // No name starts with a 1, so the next title is always drawn
+    titleText[0] = 1;
+    titleText[1] = 0;
+  }
+
+  // Notes that a column of a page has changed
+  void mark(uint8_t page, uint8_t column)
+  {
+    if(column < dirtyFirst[page])
+    {
+      dirtyFirst[page] = column;
+    }
+
+    if(column > dirtyLast[page])
+    {
+      dirtyLast[page] = column;
+    }
+  }
+
+  // Writes one byte of a page, marking it only if it differs from what is there
+  void put(uint8_t page, uint8_t column, uint8_t value)
+  {
+    uint8_t * at = oled->getBuffer() + page * OLED_WIDTH + column;
+
+    if(*at != value)
+    {
+      *at = value;
+      mark(page, column);
+    }
+  }
+
+  // Starts a frame. The buffer is kept, since it is what the panel shows and what the new frame is compared with
+  void clear()
+  {
+    oled->setTextColor(WHITE);
+    oled->setTextWrap(false);
+
+    rowsDrawn = 0;
+    cleared = 1;
+  }
+
+  // Draws the menu name in large text across the top of the screen, if it isn't already there
+  void title(char * name)
+  {
+    if(!strcmp(name, titleText))
+    {
+      return;
+    }
+
+    strncpy(titleText, name, MAX_CHAR - 1);
+    titleText[MAX_CHAR - 1] = 0;
+
+    oled->fillRect(0, 0, OLED_WIDTH, TITLE_HEIGHT, BLACK);
+    oled->setTextSize(2);
+    oled->setCursor(0, 0);
+    oled->write(" ");
+    oled->write(name);
+    oled->setTextSize(1);
+
+    for(uint8_t page = 0; page < TITLE_HEIGHT / 8; page++)
+    {
+      dirtyFirst[page] = 0;
+      dirtyLast[page] = OLED_WIDTH - 1;
+    }
+  }
+
+  // Copies one character into a page starting at column. A row is exactly one page, so each font column is one
+  // buffer byte. Returns the column the next character goes at
+  uint8_t glyph(uint8_t page, uint8_t column, char c);
+
+  // Draws one node row below the title, with an arrow if it is selected (a star while its value is edited) and the
+  // node's icon if it has one. The label is shown from character offset onwards and the rest of the row is blanked,
+  // up to the value if the row has one
+  void row(char index, char selected, const char * label, unsigned char offset, menuIcon icon, char value);
+
+  // Draws a value right aligned at the end of a row. With previous given, only the characters that differ from it are
+  // drawn, so stepping a value touches a few character cells instead of the whole row
+  void digits(char index, char * text, char * previous)
+  {
+    uint8_t column = VALUE_COLUMN;
+
+    for(unsigned char i = 0; i < VALUE_CHARS; i++, column += CHAR_WIDTH)
+    {
+      if(previous && previous[i] == text[i])
+      {
+        continue;
+      }
+
+      glyph(TITLE_HEIGHT / 8 + index, column, text[i]);
+    }
+  }
+
+  // Moves the flush on to the next page in range that has changes, finishing it if there are none
+  void nextPage()
+  {
+    while(flushPage <= flushLast && dirtyFirst[flushPage] > dirtyLast[flushPage])
+    {
+      flushPage++;
+    }
+
+    flushBusy = flushPage <= flushLast;
+  }
+
+  // Locks the frame until update() has sent the changes on the given pages. After a full frame, rows that weren't
+  // drawn are blanked first
+  void flush(unsigned char firstPage = 0, unsigned char lastPage = OLED_PAGES - 1)
+  {
+    if(cleared)
+    {
+      for(uint8_t index = 0; index < OLED_ROWS; index++)
+      {
+        for(uint8_t column = 0; !(rowsDrawn & 1 << index) && column < OLED_WIDTH; column++)
+        {
+          put(TITLE_HEIGHT / 8 + index, column, 0);
+        }
+      }
+
+      cleared = 0;
+    }
+
+    flushPage = firstPage;
+    flushLast = lastPage;
+    windowOpen = 0;
+    nextPage();
+  }
+
+  // Sends only the pages a node row sits on
+  void flushRow(char index)
+  {
+    unsigned char page = (TITLE_HEIGHT + index * ROW_HEIGHT) / 8;
+
+    flush(page, page + ROW_HEIGHT / 8 - 1);
+  }
+
+  // Sends the next part of the changes: either the address window of the next changed span, or up to FLUSH_CHUNK
+  // bytes of it. FLUSH_CHUNK must fit in the Wire buffer with the control byte
+  char update()
+  {
+    if(!flushBusy)
+    {
+      return 0;
+    }
+
+    if(!windowOpen)
+    {
+      sendFrom = dirtyFirst[flushPage];
+      sendTo = dirtyLast[flushPage];
+      dirtyFirst[flushPage] = OLED_WIDTH;
+      dirtyLast[flushPage] = 0;
+
+      // Column and page address window of the span, as one command transmission
+      Wire.beginTransmission(address);
+      Wire.write((uint8_t) 0x00);
+      Wire.write((uint8_t) SSD1306_COLUMNADDR);
+      Wire.write(sendFrom);
+      Wire.write(sendTo);
+      Wire.write((uint8_t) SSD1306_PAGEADDR);
+      Wire.write(flushPage);
+      Wire.write(flushPage);
+      Wire.endTransmission();
+
+      windowOpen = 1;
+      return flushBusy;
+    }
+
+    uint8_t count = sendTo - sendFrom + 1 < FLUSH_CHUNK ? sendTo - sendFrom + 1 : FLUSH_CHUNK;
+
+    Wire.beginTransmission(address);
+    Wire.write((uint8_t) 0x40);
+    Wire.write(oled->getBuffer() + flushPage * OLED_WIDTH + sendFrom, count);
+    Wire.endTransmission();
+
+    sendFrom += count;
+
+    if(sendFrom > sendTo)
+    {
+      windowOpen = 0;
+      flushPage++;
+      nextPage();
+    }
+
+    return flushBusy;
+  }
+
+  char busy()
+  {
+    return flushBusy;
+  }
+
+  // The frame buffer, for reading back what is on screen
+  const unsigned char * buffer()
+  {
+    return oled->getBuffer();
+  }
+
+  unsigned short bufferSize()
+  {
+    return OLED_WIDTH * OLED_HEIGHT / 8;
+  }
+
+  // Lowers the contrast while idle
+  void dim(char on)
+  {
+    oled->dim(on);
+  }
+
+  // Turns the panel off while idle. The buffer is kept so the screen comes back as it was
+  void sleep(char on)
+  {
+    oled->ssd1306_command(on ? SSD1306_DISPLAYOFF : SSD1306_DISPLAYON);
+  }
+};
+
+// Rows are blitted a page at a time
+static_assert(ROW_HEIGHT == 8 && TITLE_HEIGHT % 8 == 0, "Node rows must each sit on one page of the frame buffer");
+static_assert((LABEL_CHARS + 1) * CHAR_WIDTH <= OLED_WIDTH, "A row's label doesn't fit across the screen");
+static_assert(ICON_WIDTH <= ICON_CHARS * CHAR_WIDTH + OLED_WIDTH - (LABEL_CHARS + 1) * CHAR_WIDTH,
+              "An icon doesn't fit in the room it takes from the label");
+static_assert(MAX_ITEMS <= OLED_ROWS, "MAX_ITEMS rows don't fit below the title");
+
+#endif
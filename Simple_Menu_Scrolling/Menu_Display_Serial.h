@@ -0,0 +1,134 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Display_Serial.h: Display backend that draws the menu to a serial terminal using ANSI escape codes. Useful
+| for boards without a screen and for debugging menus from the Serial Monitor.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef MENU_DISPLAY_SERIAL_H
+#define MENU_DISPLAY_SERIAL_H
+
+#include <Arduino.h>
+
+// Nothing is held outside of menuDisplay
+#define DISPLAY_RAM     0
+
+// Terminals are wide enough for any label, so labels never scroll
+#define CHAR_WIDTH      1
+#define LABEL_CHARS     MAX_CHAR
+
+// Icons are left out on a terminal, so they take no room from the label
+#define ICON_CHARS      0
+
+/*  ---------------------------------------------------------------------------------------------------------------------/ 
+|  ------------------------------------------------ DISPLAY CLASS ------------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuDisplay: Prints the menu title and node rows to a Stream. Each build clears the terminal and homes the cursor
+| so the menu redraws in place.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - The Arduino Serial Monitor does not understand ANSI codes, use a terminal program instead
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuDisplay
+{
+  public:
+
+  // The port the menu is printed to
+  Stream * port = &Serial;
+
+  // Clear the screen and home the cursor
+  void clear()
+  {
+    port->print("\x1b[2J\x1b[H");
+  }
+
+  void title(char * name)
+  {
+    port->print(" ");
+    port->println(name);
+  }
+
+  // Moves to the row's line and clears it first so a single row can be redrawn
+  void row(char index, char selected, const char * label, unsigned char offset, menuIcon, char)
+  {
+    port->print("\x1b[");
+    port->print(index + 2);
+    port->print(";1H\x1b[K");
+    port->print(ROW_MARKS[(unsigned char) selected]);
+    port->print(' ');
+    port->print(label + offset);
+  }
+
+  // Writes a value after the longest possible label, only the characters that differ from previous if it is given
+  void digits(char index, char * text, char * previous)
+  {
+    for(unsigned char i = 0; i < VALUE_CHARS; i++)
+    {
+      if(!previous || previous[i] != text[i])
+      {
+        port->print("\x1b[");
+        port->print(index + 2);
+        port->print(';');
+        port->print(LABEL_CHARS + 4 + i);
+        port->print('H');
+        port->print(text[i]);
+      }
+    }
+  }
+
+  void flush()
+  {
+  }
+
+  void flushRow(char)
+  {
+  }
+
+  char update()
+  {
+    return 0;
+  }
+
+  // Every frame is written to the terminal in full, there is nothing to invalidate
+  void invalidate()
+  {
+  }
+
+  char busy()
+  {
+    return 0;
+  }
+
+  // Nothing is kept to read back, the text only lives on the terminal
+  const unsigned char * buffer()
+  {
+    return 0;
+  }
+
+  unsigned short bufferSize()
+  {
+    return 0;
+  }
+
+  void dim(char)
+  {
+  }
+
+  // Clears the terminal while idle
+  void sleep(char on)
+  {
+    if(on)
+    {
+      clear();
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,484 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Remote.cpp: Receiving, applying and answering remote control frames. See Menu_Remote.h for the frame layout.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#include "Menu_Remote.h"
+
+#include <Arduino.h>
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRemote::menuRemote: Sets up remote control of a frame over a port. The port has to be started by the program.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuFrame * framePtr: the frame the commands are applied to
+|
+| - Stream * portPtr: the port commands are read from and replies are written to, e.g. &Serial
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+menuRemote::menuRemote(menuFrame * framePtr, Stream * portPtr)
+{
+    this->frame = framePtr;
+    this->port = portPtr;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRemote::poll: Reads what has arrived on the port and handles every complete frame in it. Should be called every
+| pass of the main loop; at most REMOTE_POLL_BYTES are read each call.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the number of frames handled
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+unsigned char menuRemote::poll()
+{
+    unsigned char handled = 0;
+
+    for(unsigned char i = 0; i < REMOTE_POLL_BYTES && this->port->available() > 0; i++)
+    {
+        handled += this->receive(this->port->read());
+    }
+
+    return handled;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRemote::receive: Takes one byte of an incoming frame. Bytes before a start byte are skipped, and a frame is
+| handled once its CRC has arrived.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned char byte: the byte read from the port
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if the byte finished a frame, otherwise 0
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Payload bytes past REMOTE_PAYLOAD are read and counted in the CRC but not kept, so the receiver stays in step
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+char menuRemote::receive(unsigned char byte)
+{
+    switch(this->stage)
+    {
+        case REMOTE_WAIT:
+        if(byte == REMOTE_SOF)
+        {
+            this->crc = 0xFFFF;
+            this->stage = REMOTE_LENGTH;
+        }
+        break;
+
+        case REMOTE_LENGTH:
+        this->length = byte;
+        this->count = 0;
+        this->crc = menuCrcStep(this->crc, byte);
+        this->stage = REMOTE_COMMAND;
+        break;
+
+        case REMOTE_COMMAND:
+        this->command = byte;
+        this->crc = menuCrcStep(this->crc, byte);
+        this->stage = this->length ? REMOTE_DATA : REMOTE_CRC_HIGH;
+        break;
+
+        case REMOTE_DATA:
+        if(this->count < REMOTE_PAYLOAD)
+        {
+            this->data[this->count] = byte;
+        }
+
+        this->crc = menuCrcStep(this->crc, byte);
+
+        if(++this->count == this->length)
+        {
+            this->stage = REMOTE_CRC_HIGH;
+        }
+        break;
+
+        case REMOTE_CRC_HIGH:
+        this->crc ^= (unsigned short) byte << 8;
+        this->stage = REMOTE_CRC_LOW;
+        break;
+
+        case REMOTE_CRC_LOW:
+        this->crc ^= byte;
+        this->stage = REMOTE_WAIT;
+        this->handle();
+        return 1;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRemote::handle: Checks a complete frame and carries out its command
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuRemote::handle()
+{
+    // The received CRC was xored into the one worked out, so a good frame leaves 0
+    if(this->crc)
+    {
+        this->errorCount++;
+        this->begin(REMOTE_ERR_CRC, 0);
+        this->end();
+        return;
+    }
+
+    if(this->length > REMOTE_PAYLOAD)
+    {
+        this->errorCount++;
+        this->begin(REMOTE_ERR_SIZE, 0);
+        this->end();
+        return;
+    }
+
+    this->frameCount++;
+
+    switch(this->command)
+    {
+        case REMOTE_NAV:
+        this->nav();
+        break;
+
+        case REMOTE_JUMP:
+        this->jump();
+        break;
+
+        case REMOTE_STATE:
+        this->state();
+        break;
+
+        case REMOTE_TEXT:
+        this->text();
+        break;
+
+        case REMOTE_DUMP:
+        this->dump();
+        break;
+
+        default:
+        this->begin(REMOTE_ERR_CMD, 0);
+        this->end();
+        break;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRemote::nav: Applies a batch of navigation steps in order, as if the buttons had been pressed. Stops at the
+| first step that isn't recognised.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuRemote::nav()
+{
+    unsigned char done = 0;
+
+    for(; done < this->length; done++)
+    {
+        switch(this->data[done])
+        {
+            case 'u':
+            this->frame->newUp();
+            continue;
+
+            case 'd':
+            this->frame->newDown();
+            continue;
+
+            case 'c':
+            this->frame->choose();
+            continue;
+
+            case 'b':
+            this->frame->back();
+            continue;
+
+            case 'p':
+            this->frame->pageUp();
+            continue;
+
+            case 'n':
+            this->frame->pageDown();
+            continue;
+
+            case 'e':
+            this->frame->toEnd();
+            continue;
+        }
+
+        break;
+    }
+
+    this->begin(done == this->length ? REMOTE_OK : REMOTE_ERR_ARG, 1);
+    this->put(done);
+    this->end();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRemote::jump: Moves the frame straight to a node
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuRemote::jump()
+{
+    char moved = 0;
+
+    if(this->length == 4)
+    {
+        unsigned short menuNum = this->data[0] | (unsigned short) this->data[1] << 8;
+        unsigned short nodeNum = this->data[2] | (unsigned short) this->data[3] << 8;
+
+        moved = menuNum < MAX_MENUS && nodeNum < MAX_NODES && this->frame->jump(menuNum, nodeNum);
+    }
+
+    this->begin(moved ? REMOTE_OK : REMOTE_ERR_ARG, 0);
+    this->end();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRemote::state: Sends back where the frame is: its menu, node, window and whether it is editing or idle
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuRemote::state()
+{
+    this->begin(REMOTE_OK, 11);
+    this->putWord(this->frame->currentMenu);
+    this->putWord(this->frame->nodeIndex);
+    this->putWord(this->frame->menuStartIndex);
+    this->putWord(this->frame->arrowIndex);
+    this->put(this->frame->depth);
+    this->put(this->frame->editing);
+    this->put(this->frame->idleState);
+    this->end();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRemote::text: Sends back the text of the current view: the title and the label of each visible node, in the
+| current language
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Each label is looked up twice, once to size the reply and once to send it, so nothing has to be buffered
+| - The cursor is fitted to the menu first, as newBuild would, so a menu shortened since the last build doesn't leave
+|   the window past its end
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuRemote::text()
+{
+    // Another frame may have removed nodes from under the window since the last build
+    this->frame->fitCursor();
+
+    menuTree * tree = this->frame->tree;
+    menuIndex menuNum = this->frame->currentMenu;
+    menuIndex start = this->frame->menuStartIndex;
+    menuIndex shown = tree->menuList[menuNum].nodeCount - start;
+    char label[MAX_CHAR];
+
+    if(shown > MAX_ITEMS)
+    {
+        shown = MAX_ITEMS;
+    }
+
+    unsigned char size = strlen(tree->menuName(menuNum, label)) + 1;
+
+    for(menuIndex i = 0; i < shown; i++)
+    {
+        size += strlen(tree->nodeName(menuNum, start + i, label)) + 1;
+    }
+
+    this->begin(REMOTE_OK, size);
+
+    for(char * c = tree->menuName(menuNum, label); ; c++)
+    {
+        this->put(*c);
+
+        if(!*c)
+        {
+            break;
+        }
+    }
+
+    for(menuIndex i = 0; i < shown; i++)
+    {
+        for(const char * c = tree->nodeName(menuNum, start + i, label); ; c++)
+        {
+            this->put(*c);
+
+            if(!*c)
+            {
+                break;
+            }
+        }
+    }
+
+    this->end();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRemote::dump: Sends back part of the display buffer, starting at the requested offset. The host asks for the
+| next offset until it has the whole buffer. Displays that keep no buffer report a size of 0.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuRemote::dump()
+{
+    const unsigned char * buffer = this->frame->display.buffer();
+    unsigned short size = this->frame->display.bufferSize();
+    unsigned short offset = this->length == 2 ? this->data[0] | (unsigned short) this->data[1] << 8 : 0;
+
+    if(this->length != 2 || (offset && offset >= size))
+    {
+        this->begin(REMOTE_ERR_ARG, 0);
+        this->end();
+        return;
+    }
+
+    unsigned short chunk = size - offset < REMOTE_CHUNK ? size - offset : REMOTE_CHUNK;
+
+    this->begin(REMOTE_OK, 4 + chunk);
+    this->putWord(offset);
+    this->putWord(size);
+
+    for(unsigned short i = 0; i < chunk; i++)
+    {
+        this->put(buffer[offset + i]);
+    }
+
+    this->end();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRemote::begin: Starts a reply to the frame being handled. The reply is sent as it is written, with put() and
+| putWord() adding to it and end() finishing it.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned char status: the REMOTE_ status of the reply
+|
+| - unsigned char size: the number of bytes that will follow the status
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuRemote::begin(unsigned char status, unsigned char size)
+{
+    this->port->write((uint8_t) REMOTE_SOF);
+
+    this->sendCrc = 0xFFFF;
+    this->put(size + 1);
+    this->put(this->command | REMOTE_REPLY);
+    this->put(status);
+}
+
+void menuRemote::put(unsigned char byte)
+{
+    this->port->write((uint8_t) byte);
+    this->sendCrc = menuCrcStep(this->sendCrc, byte);
+}
+
+void menuRemote::putWord(unsigned short word)
+{
+    this->put(word & 0xFF);
+    this->put(word >> 8);
+}
+
+void menuRemote::end()
+{
+    this->port->write((uint8_t) (this->sendCrc >> 8));
+    this->port->write((uint8_t) (this->sendCrc & 0xFF));
+}
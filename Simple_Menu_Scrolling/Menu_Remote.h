@@ -0,0 +1,145 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Remote.h: Remote control of a menu frame over a serial port, for test rigs and host tools. Commands and replies
+| are sent in small binary frames checked with a CRC, and any number of them can be handled each pass of the loop.
+|
+| Frame layout (both directions):
+|
+|   0x7E | length | command | payload (length bytes) | CRC high | CRC low
+|
+| The CRC is CRC-16/CCITT (polynomial 0x1021, starting at 0xFFFF) over the length, command and payload bytes. 16 bit
+| numbers in payloads are sent low byte first. Each reply uses the command with its top bit set, and its payload
+| starts with a REMOTE_ status byte:
+|
+|   REMOTE_NAV   payload: up to REMOTE_PAYLOAD steps                   reply: number of steps done
+|                (u)p, (d)own, (c)hoose, (b)ack, (p)age up, (n)ext page, (e)nd
+|   REMOTE_JUMP  payload: menu (16), node (16)                         reply: nothing more
+|   REMOTE_STATE payload: none                                         reply: menu, node, window start, arrow (16 each),
+|                                                                             depth, editing, idle state (8 each)
+|   REMOTE_TEXT  payload: none                                         reply: the title and each visible label, each
+|                                                                             followed by a 0
+|   REMOTE_DUMP  payload: offset (16)                                  reply: offset, size (16 each), then up to
+|                                                                             REMOTE_CHUNK bytes of the display buffer
+|
+| tools/menu_remote.py is a client for it.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef MENU_REMOTE_H
+#define MENU_REMOTE_H
+
+#include "Simple_Menu_Scrolling.h"
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// --------------------------- /    \   / ___/  / ___/  /_  _/  / \  / /  / ___/  / ____/ ----------------------------- //
+// -------------------------- / /_\ /  / __/   / __/     / /   / /\\/ /  / __/    \__ \  ------------------------------ //
+// ------------------------- /_____/  /____/  /_/      /___/  /_/  \_/  /____/  /_____/ ------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+// Largest command payload accepted, and the most display buffer bytes sent in one dump reply
+#ifndef REMOTE_PAYLOAD
+#define REMOTE_PAYLOAD  32
+#endif
+#ifndef REMOTE_CHUNK
+#define REMOTE_CHUNK    128
+#endif
+
+// Most bytes read from the port in one poll, so a flood of input can't hold up the loop
+#ifndef REMOTE_POLL_BYTES
+#define REMOTE_POLL_BYTES 64
+#endif
+
+// Start of every frame
+#define REMOTE_SOF      0x7E
+
+// Commands
+#define REMOTE_NAV      0x01
+#define REMOTE_JUMP     0x02
+#define REMOTE_STATE    0x03
+#define REMOTE_TEXT     0x04
+#define REMOTE_DUMP     0x05
+
+// Set in the command of a reply
+#define REMOTE_REPLY    0x80
+
+// Reply status
+#define REMOTE_OK       0
+#define REMOTE_ERR_CMD  1
+#define REMOTE_ERR_ARG  2
+#define REMOTE_ERR_CRC  3
+#define REMOTE_ERR_SIZE 4
+
+// Receive stages
+#define REMOTE_WAIT     0
+#define REMOTE_LENGTH   1
+#define REMOTE_COMMAND  2
+#define REMOTE_DATA     3
+#define REMOTE_CRC_HIGH 4
+#define REMOTE_CRC_LOW  5
+
+class Stream;
+
+// Reply lengths are sent in one byte
+static_assert((MAX_ITEMS + 1) * MAX_CHAR < 255, "REMOTE_TEXT replies don't fit in a frame, lower MAX_ITEMS or MAX_CHAR");
+static_assert(REMOTE_CHUNK + 4 < 255, "REMOTE_CHUNK doesn't fit in a frame");
+static_assert(REMOTE_PAYLOAD < 256, "REMOTE_PAYLOAD doesn't fit in a frame");
+
+/*  ---------------------------------------------------------------------------------------------------------------------/
+|  ------------------------------------------------- REMOTE CLASS ------------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuRemote: Reads command frames from a stream, applies them to a menu frame and sends back a reply for each one.
+| Bytes are taken as they arrive, so a frame split over several polls is put back together. Frames that are too
+| long or fail the CRC are answered with an error and dropped.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Replies are written straight to the port as they are worked out, so no transmit buffer is kept
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuRemote
+{
+  public:
+
+  // The frame being controlled and the port the commands come in on
+  menuFrame * frame;
+  Stream * port;
+
+  // Where the receiver is in the current frame, and the parts of it read so far
+  char stage = REMOTE_WAIT;
+  unsigned char length = 0;
+  unsigned char command = 0;
+  unsigned char count = 0;
+  unsigned char data[REMOTE_PAYLOAD];
+  unsigned short crc = 0;
+
+  // CRC of the reply being sent
+  unsigned short sendCrc = 0;
+
+  // Number of frames handled and dropped for a bad CRC or length
+  unsigned long frameCount = 0;
+  unsigned long errorCount = 0;
+
+  menuRemote(menuFrame * framePtr, Stream * portPtr);
+
+  unsigned char poll();
+  char receive(unsigned char byte);
+  void handle();
+
+  void nav();
+  void jump();
+  void state();
+  void text();
+  void dump();
+
+  void begin(unsigned char status, unsigned char size);
+  void put(unsigned char byte);
+  void putWord(unsigned short word);
+  void end();
+};
+
+#endif
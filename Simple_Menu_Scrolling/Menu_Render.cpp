@@ -0,0 +1,409 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Render.cpp: Publishing frame snapshots and drawing them from a render task. See Menu_Render.h.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#include "Menu_Render.h"
+
+#include <Arduino.h>
+
+// Host builds (tools/host) run the render task on a thread
+#if !defined(ESP32) && defined(HOST_ARDUINO_H)
+#include <chrono>
+#include <thread>
+#endif
+
+// Snapshot slots are copied a byte at a time with relaxed atomics: the sequence counts do the ordering, and the copy
+// is allowed to race with a write because a torn copy is always thrown away
+static void writeSlot(menuSnapshot * slot, const menuSnapshot * from)
+{
+    unsigned char * to = (unsigned char *) slot;
+    const unsigned char * bytes = (const unsigned char *) from;
+
+    for(unsigned int i = 0; i < sizeof(menuSnapshot); i++)
+    {
+        __atomic_store_n(&to[i], bytes[i], __ATOMIC_RELAXED);
+    }
+}
+
+static void readSlot(menuSnapshot * to, const menuSnapshot * slot)
+{
+    unsigned char * bytes = (unsigned char *) to;
+    const unsigned char * from = (const unsigned char *) slot;
+
+    for(unsigned int i = 0; i < sizeof(menuSnapshot); i++)
+    {
+        bytes[i] = __atomic_load_n(&from[i], __ATOMIC_RELAXED);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRender::menuRender: Sets up drawing a frame from snapshots. Nothing runs until start() is called.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuFrame * framePtr: the frame to draw. Its menus should be built before the first publish()
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+menuRender::menuRender(menuFrame * framePtr)
+{
+    this->frame = framePtr;
+
+    memset(this->slots, 0, sizeof(this->slots));
+    memset(&this->shown, 0, sizeof(this->shown));
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRender::start: Starts the render task
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if the task is running, 0 if it couldn't be made or the board has no render task (call render() from
+| the loop instead)
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+char menuRender::start()
+{
+    if(this->worker)
+    {
+        return 1;
+    }
+
+    __atomic_store_n(&this->running, 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&this->finished, 0, __ATOMIC_RELEASE);
+
+#if defined(ESP32)
+    if(xTaskCreatePinnedToCore(menuRender::task, "menuRender", RENDER_STACK, this, RENDER_PRIORITY,
+                               (TaskHandle_t *) &this->worker, RENDER_CORE) != pdPASS)
+    {
+        this->worker = NULL;
+    }
+#elif defined(HOST_ARDUINO_H)
+    this->worker = new std::thread(menuRender::task, this);
+#endif
+
+    return this->worker != NULL;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRender::stop: Stops the render task once it has finished the frame it is on, and waits for it to end
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - On the ESP32 the task deletes itself, so this waits for it to say it is done with the menuRender before returning;
+|   the menuRender can then be freed or started again. Must not be called from the render task itself
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuRender::stop()
+{
+    __atomic_store_n(&this->running, 0, __ATOMIC_RELEASE);
+
+#if defined(ESP32)
+    while(this->worker && !__atomic_load_n(&this->finished, __ATOMIC_ACQUIRE))
+    {
+        vTaskDelay(pdMS_TO_TICKS(RENDER_WAIT_MS));
+    }
+#elif defined(HOST_ARDUINO_H)
+    if(this->worker)
+    {
+        ((std::thread *) this->worker)->join();
+        delete (std::thread *) this->worker;
+    }
+#endif
+
+    this->worker = NULL;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRender::task: The render task. Draws each new snapshot as it is published until stop() is called.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - void * arg: the menuRender to run
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuRender::task(void * arg)
+{
+    menuRender * renderer = (menuRender *) arg;
+
+    while(__atomic_load_n(&renderer->running, __ATOMIC_ACQUIRE))
+    {
+        if(renderer->render())
+        {
+            continue;
+        }
+
+#if defined(ESP32)
+        vTaskDelay(pdMS_TO_TICKS(RENDER_WAIT_MS));
+#elif defined(HOST_ARDUINO_H)
+        std::this_thread::sleep_for(std::chrono::milliseconds(RENDER_WAIT_MS));
+#endif
+    }
+
+    // Nothing of the menuRender is touched after this, so stop() can return
+    __atomic_store_n(&renderer->finished, 1, __ATOMIC_RELEASE);
+
+#if defined(ESP32)
+    vTaskDelete(NULL);
+#endif
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRender::publish: Works out what the frame should show and, if it has changed, publishes it for the render task.
+| Takes the place of newBuild in the loop, and never waits on the display.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if a new snapshot was published, otherwise 0
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Also applies the frame's queued edits and moves the scrolling label along, which newBuild and update do otherwise
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+char menuRender::publish()
+{
+    menuFrame * frame = this->frame;
+
+    if(frame->queue)
+    {
+        frame->queue->apply(frame->tree);
+    }
+
+    frame->fitCursor();
+    frame->marqueeFollow();
+    frame->marqueeStep();
+
+    unsigned long hash = frame->frameHash();
+
+    if(hash == this->publishedHash)
+    {
+        // Once the render task has sent that snapshot, the display already shows the result of any waiting input.
+        // Until then the input waits, as it does in newBuild while a frame is still being sent
+        if(frame->inputPending && __atomic_load_n(&this->drawnHash, __ATOMIC_ACQUIRE) == hash)
+        {
+            frame->recordLatency(frame->inputTime);
+            frame->inputPending = 0;
+        }
+
+        return 0;
+    }
+
+    menuSnapshot snapshot;
+
+    this->compose(&snapshot);
+    snapshot.hash = hash;
+
+    // Write the slot the render task isn't meant to be reading. Its count is odd until the copy is finished
+    unsigned char slot = this->latest ^ 1;
+    unsigned char count = this->sequence[slot];
+
+    __atomic_store_n(&this->sequence[slot], (unsigned char) (count + 1), __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    writeSlot(&this->slots[slot], &snapshot);
+
+    __atomic_store_n(&this->sequence[slot], (unsigned char) (count + 2), __ATOMIC_RELEASE);
+    __atomic_store_n(&this->latest, slot, __ATOMIC_RELEASE);
+
+    this->publishedHash = hash;
+    this->publishCount++;
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRender::compose: Copies what the frame shows out of the tree, the same way newBuild draws it
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuSnapshot * snapshot: the snapshot to fill, except for its hash
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Takes the frame's waiting input, so the render task records its latency when this snapshot is sent
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuRender::compose(menuSnapshot * snapshot)
+{
+    menuFrame * frame = this->frame;
+    menuTree * tree = frame->tree;
+    menu * shown = &tree->menuList[frame->currentMenu];
+    char label[MAX_CHAR];
+
+    memset(snapshot, 0, sizeof(menuSnapshot));
+
+    snapshot->input = frame->inputPending;
+    snapshot->inputTime = frame->inputTime;
+    frame->inputPending = 0;
+
+    strcpy(snapshot->title, tree->menuName(frame->currentMenu, label));
+
+    for(int i = 0; i < MAX_ITEMS && i + frame->menuStartIndex < shown->nodeCount; i++)
+    {
+        const menuNode * node = &shown->node[i + frame->menuStartIndex];
+        char selected = i == frame->arrowIndex;
+
+        snapshot->rows++;
+        snapshot->mark[i] = selected ? 1 + frame->editing : 0;
+        snapshot->shift[i] = selected ? frame->marqueeShift() : 0;
+        strcpy(snapshot->label[i], tree->nodeName(frame->currentMenu, i + frame->menuStartIndex, label));
+        snapshot->icon[i] = tree->nodeIcon(frame->currentMenu, i + frame->menuStartIndex);
+
+        if(node->nodeType == NUM_NODE)
+        {
+            menuValue * value = tree->values[node->target];
+
+            value->format(selected && frame->editing ? frame->editValue : value->value, snapshot->value[i]);
+        }
+    }
+
+    // Every snapshot draws the whole frame, so a value change needs no separate digit redraw
+    frame->valueDirty = 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRender::render: Draws and sends the newest snapshot if it isn't on the display already. Only the render task
+| calls this, or the loop on boards without one.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if a frame was drawn, otherwise 0
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Waits for the whole frame to be sent, which only holds up the render task
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+char menuRender::render()
+{
+    if(!this->take(&this->shown) || this->shown.hash == this->drawnHash)
+    {
+        return 0;
+    }
+
+    menuDisplay * display = &this->frame->display;
+    unsigned long start = micros();
+
+    display->clear();
+    display->title(this->shown.title);
+
+    for(unsigned char i = 0; i < this->shown.rows; i++)
+    {
+        display->row(i, this->shown.mark[i], this->shown.label[i], this->shown.shift[i], this->shown.icon[i],
+                     this->shown.value[i][0]);
+
+        if(this->shown.value[i][0])
+        {
+            display->digits(i, this->shown.value[i], NULL);
+        }
+    }
+
+    display->flush();
+
+    while(display->update())
+    {
+    }
+
+    unsigned long time = micros() - start;
+
+    this->renderTotal += time;
+    this->renderWorst = time > this->renderWorst ? time : this->renderWorst;
+    this->drawCount++;
+
+    if(this->shown.input)
+    {
+        this->frame->recordLatency(this->shown.inputTime);
+    }
+
+    // Last, since publish() records latency itself once it sees the snapshot drawn
+    __atomic_store_n(&this->drawnHash, this->shown.hash, __ATOMIC_RELEASE);
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuRender::take: Copies the newest published snapshot. A copy that the publisher wrote over while it was being
+| taken is thrown away and taken again.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuSnapshot * snapshot: where the copy goes
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 once a whole snapshot is copied
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Only waits while the publisher is writing the slot being copied, which takes two publishes during one copy
+| - Before the first publish this copies an empty slot, whose hash of 0 render() takes as already drawn
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+char menuRender::take(menuSnapshot * snapshot)
+{
+    for(;;)
+    {
+        unsigned char slot = __atomic_load_n(&this->latest, __ATOMIC_ACQUIRE);
+        unsigned char before = __atomic_load_n(&this->sequence[slot], __ATOMIC_ACQUIRE);
+
+        if(!(before & 1))
+        {
+            readSlot(snapshot, &this->slots[slot]);
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+            if(__atomic_load_n(&this->sequence[slot], __ATOMIC_RELAXED) == before)
+            {
+                return 1;
+            }
+        }
+
+        this->retryCount++;
+    }
+}
@@ -0,0 +1,147 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Render.h: Drawing a menu frame from a task of its own, so the loop handling input never waits on the display.
+| The loop publishes what the frame should show as a snapshot (the title, the visible labels, their marks and values)
+| and the render task draws the newest snapshot whenever it changes. Snapshots are handed over through two slots,
+| each guarded by a sequence count (a seqlock): publishing never waits, and the render task copies a slot again if it
+| was written over while being copied.
+|
+| On the ESP32 the task runs pinned to RENDER_CORE, away from the Arduino loop. Host builds run it on a std::thread.
+| Anywhere else start() returns 0 and render() can be called from the loop instead.
+|
+|   menuRender renderer(&frame);
+|   renderer.start();                    (setup)
+|   frame.newDown(); renderer.publish(); (loop, in place of newBuild and update)
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef MENU_RENDER_H
+#define MENU_RENDER_H
+
+#include "Simple_Menu_Scrolling.h"
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// --------------------------- /    \   / ___/  / ___/  /_  _/  / \  / /  / ___/  / ____/ ----------------------------- //
+// -------------------------- / /_\ /  / __/   / __/     / /   / /\\/ /  / __/    \__ \  ------------------------------ //
+// ------------------------- /_____/  /____/  /_/      /___/  /_/  \_/  /____/  /_____/ ------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+// Core, priority and stack (bytes) of the ESP32 render task. The Arduino loop runs on core 1
+#ifndef RENDER_CORE
+#define RENDER_CORE     0
+#endif
+#ifndef RENDER_PRIORITY
+#define RENDER_PRIORITY 1
+#endif
+#ifndef RENDER_STACK
+#define RENDER_STACK    4096
+#endif
+
+// Time (millis) the render task sleeps when there is nothing new to draw
+#ifndef RENDER_WAIT_MS
+#define RENDER_WAIT_MS  1
+#endif
+
+/*  ---------------------------------------------------------------------------------------------------------------------/
+|  ------------------------------------------------- SNAPSHOT CLASS ----------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuSnapshot: Everything the render task needs to draw one frame, copied out of the tree so the task never reads it
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Never changed once published; the render task works from its own copy
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuSnapshot
+{
+  public:
+
+  // frameHash of the view, so a snapshot already drawn isn't drawn again
+  unsigned long hash;
+
+  // Time (micros) of the oldest input the snapshot is the first to show, if input is set
+  unsigned long inputTime;
+  char input;
+
+  char title[MAX_CHAR];
+
+  // Rows in use, and for each one its ROW_MARKS index, label, characters scrolled, value text ("" if none) and icon
+  // (in flash, so only the pointer is copied)
+  unsigned char rows;
+  char mark[MAX_ITEMS];
+  char label[MAX_ITEMS][MAX_CHAR];
+  unsigned char shift[MAX_ITEMS];
+  char value[MAX_ITEMS][VALUE_CHARS + 1];
+  menuIcon icon[MAX_ITEMS];
+};
+
+/*  ---------------------------------------------------------------------------------------------------------------------/
+|  -------------------------------------------------- RENDER CLASS -----------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuRender: Splits a frame in two. publish() runs in the loop with the navigation and only reads the tree; render()
+| runs in the render task and is the only thing that touches the display.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - The frame's newBuild and update must not be called while the render task runs
+| - Dimming and blanking are driven from update(), so the display stays awake in this mode
+| - Latency is recorded by the render task once a frame is sent; an input that changes nothing on screen is counted by
+|   publish() once the frame before it has been sent
+| - Anything else on the display's bus (e.g. Wire on the SSD1306) must only be used from the render task
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuRender
+{
+  public:
+
+  // The frame being drawn
+  menuFrame * frame;
+
+  // The two snapshot slots, the sequence count of each (odd while it is being written) and the slot published last
+  menuSnapshot slots[2];
+  volatile unsigned char sequence[2] = {0, 0};
+  volatile unsigned char latest = 0;
+
+  // Publishing side: signature of the snapshot published last, and the number published
+  unsigned long publishedHash = 0;
+  unsigned long publishCount = 0;
+
+  // Render side: the snapshot being drawn, the signature of the one drawn last, the number drawn, the copies taken
+  // again because the slot changed under them, and the total and worst time (us) spent drawing and sending
+  menuSnapshot shown;
+  unsigned long drawnHash = 0;
+  unsigned long drawCount = 0;
+  unsigned long retryCount = 0;
+  unsigned long renderTotal = 0;
+  unsigned long renderWorst = 0;
+
+  // The render task (a TaskHandle_t or std::thread), whether it should keep going, and whether it has finished: set
+  // by the task as the last thing it does with the menuRender
+  void * worker = NULL;
+  volatile char running = 0;
+  volatile char finished = 0;
+
+  menuRender(menuFrame * framePtr);
+
+  char start();
+  void stop();
+
+  char publish();
+  void compose(menuSnapshot * snapshot);
+
+  char render();
+  char take(menuSnapshot * snapshot);
+
+  static void task(void * arg);
+};
+
+#endif
@@ -0,0 +1,399 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Store.cpp: Saving and restoring the position of a menu frame. See Menu_Store.h for the record layout.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#include "Menu_Store.h"
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <stddef.h>
+
+// EEPROM on these is a copy in RAM that has to be opened with a size and committed to flash after writing
+#if defined(ESP32) || defined(ESP8266)
+#define STORE_COMMIT    1
+#else
+#define STORE_COMMIT    0
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuStore::menuStore: Sets up saving the position of a frame. Nothing is read until restore() is called.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuFrame * framePtr: the frame whose position is kept
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+menuStore::menuStore(menuFrame * framePtr)
+{
+    this->frame = framePtr;
+
+    memset(&this->saved, 0, sizeof(this->saved));
+    memset(&this->seen, 0, sizeof(this->seen));
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuStore::restore: Reads every slot once, finds the newest record that checks out and puts the frame back where
+| it says. Call once at startup, after the menus are built and before the first newBuild, so the first frame drawn
+| is already the restored one.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if the frame was restored, 0 if nothing was saved yet or the saved position no longer fits the menus
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Must be called before the first poll() or save(), as it is what finds the slot the next save goes to
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+char menuStore::restore()
+{
+#if STORE_COMMIT
+    EEPROM.begin(STORE_ADDRESS + STORE_BYTES);
+#endif
+
+    menuRecord record;
+    menuRecord newest;
+    char found = 0;
+
+    for(unsigned char i = 0; i < STORE_SLOTS; i++)
+    {
+        read(i, &record);
+
+        if(record.size != sizeof(menuRecord) || record.crc != check(&record))
+        {
+            continue;
+        }
+
+        // Sequence numbers wrap, so the newest is the one the others are behind
+        if(!found || (short) (record.sequence - newest.sequence) > 0)
+        {
+            newest = record;
+            this->slot = i;
+            found = 1;
+        }
+    }
+
+    char restored = 0;
+
+    if(found)
+    {
+        this->sequence = newest.sequence;
+
+        if(this->fits(&newest))
+        {
+            this->apply(&newest);
+            restored = 1;
+        }
+    }
+
+    // Wherever the frame ended up is what is saved now, so it isn't written again straight away
+    this->capture(&this->saved);
+    this->seen = this->saved;
+    this->pending = 0;
+
+    return restored;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuStore::poll: Saves the frame's position once it has moved and then stayed put for STORE_DELAY_MS. Should be
+| called every pass of the main loop.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if a record was written, otherwise 0
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Moving away and back again before the delay is up writes nothing
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+char menuStore::poll()
+{
+    menuRecord now;
+
+    this->capture(&now);
+
+    // Every move starts the delay again
+    if(!same(&now, &this->seen))
+    {
+        this->seen = now;
+        this->changeTime = millis();
+    }
+
+    this->pending = !same(&this->seen, &this->saved);
+
+    if(!this->pending || millis() - this->changeTime < STORE_DELAY_MS)
+    {
+        return 0;
+    }
+
+    this->save();
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuStore::save: Writes the frame's position to the next slot straight away, e.g. before a planned power down
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - The newest record is never written over, so losing power part way through leaves the one before it
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuStore::save()
+{
+    this->slot = (this->slot + 1) % STORE_SLOTS;
+    this->sequence++;
+
+    this->capture(&this->saved);
+    this->saved.sequence = this->sequence;
+    this->saved.crc = check(&this->saved);
+
+    write(this->slot, &this->saved);
+
+#if STORE_COMMIT
+    EEPROM.commit();
+#endif
+
+    this->seen = this->saved;
+    this->pending = 0;
+    this->writeCount++;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuStore::capture: Fills a record with where the frame is now. The sequence number and CRC are left for save()
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuRecord * record: the record to fill
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - History entries past the depth are left as 0 so they can't make two equal positions look different
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuStore::capture(menuRecord * record)
+{
+    memset(record, 0, sizeof(menuRecord));
+
+    record->size = sizeof(menuRecord);
+    record->menu = this->frame->currentMenu;
+    record->node = this->frame->nodeIndex;
+    record->start = this->frame->menuStartIndex;
+    record->depth = this->frame->depth;
+
+    memcpy(record->history, this->frame->history, this->frame->depth * sizeof(menuIndex));
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuStore::fits: Checks a saved position against the menus as they are built now, which may have changed since it
+| was saved
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - const menuRecord * record: the position to check
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if the menu, node and every menu in the history exist, otherwise 0
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+char menuStore::fits(const menuRecord * record)
+{
+    menuTree * tree = this->frame->tree;
+
+    if(record->menu >= MAX_MENUS || record->node >= tree->menuList[record->menu].nodeCount)
+    {
+        return 0;
+    }
+
+    if(record->start > record->node || record->depth > MAX_DEPTH)
+    {
+        return 0;
+    }
+
+    for(unsigned char i = 0; i < record->depth; i++)
+    {
+        if(record->history[i] >= MAX_MENUS || !tree->menuList[record->history[i]].nodeCount)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuStore::apply: Puts the frame at a saved position. Each menu in the history is left on the node that opens the
+| next one, so going back retraces the path the way it was taken.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - const menuRecord * record: the position, already checked with fits()
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuStore::apply(const menuRecord * record)
+{
+    menuFrame * frame = this->frame;
+
+    for(unsigned char i = 0; i < record->depth; i++)
+    {
+        menu * parent = &frame->tree->menuList[record->history[i]];
+        menuIndex child = i + 1 < record->depth ? record->history[i + 1] : record->menu;
+
+        for(menuIndex n = 0; n < parent->nodeCount; n++)
+        {
+            if(parent->node[n].nodeType == SUB_NODE && parent->node[n].target == child)
+            {
+                frame->savedNode[record->history[i]] = n;
+                break;
+            }
+        }
+    }
+
+    frame->depth = record->depth;
+    memcpy(frame->history, record->history, sizeof(frame->history));
+
+    frame->currentMenu = record->menu;
+    frame->menuStartIndex = record->start;
+    frame->place(record->node);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuStore::read, write: Copy one record between a slot in EEPROM and memory, a byte at a time
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned char slotNum: the slot, 0 to STORE_SLOTS - 1
+|
+| - menuRecord * record: the record read into or written from
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Bytes that already hold the right value are not written again
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuStore::read(unsigned char slotNum, menuRecord * record)
+{
+    unsigned char * bytes = (unsigned char *) record;
+    int address = STORE_ADDRESS + slotNum * sizeof(menuRecord);
+
+    for(unsigned char i = 0; i < sizeof(menuRecord); i++)
+    {
+        bytes[i] = EEPROM.read(address + i);
+    }
+}
+
+void menuStore::write(unsigned char slotNum, const menuRecord * record)
+{
+    const unsigned char * bytes = (const unsigned char *) record;
+    int address = STORE_ADDRESS + slotNum * sizeof(menuRecord);
+
+    for(unsigned char i = 0; i < sizeof(menuRecord); i++)
+    {
+#if STORE_COMMIT
+        // write() only marks the copy in RAM dirty when the byte changes
+        EEPROM.write(address + i, bytes[i]);
+#else
+        EEPROM.update(address + i, bytes[i]);
+#endif
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuStore::check: Works out the CRC of a record, over every byte before the CRC itself
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - const menuRecord * record: the record
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the CRC-16/CCITT of the record
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+unsigned short menuStore::check(const menuRecord * record)
+{
+    const unsigned char * bytes = (const unsigned char *) record;
+    unsigned short crc = 0xFFFF;
+
+    for(unsigned char i = 0; i < offsetof(menuRecord, crc); i++)
+    {
+        crc = menuCrcStep(crc, bytes[i]);
+    }
+
+    return crc;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuStore::same: Tells if two records hold the same position, whatever their sequence numbers and CRCs
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - const menuRecord * a, b: the records to compare, both filled by capture()
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if they are the same position, otherwise 0
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| -
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+char menuStore::same(const menuRecord * a, const menuRecord * b)
+{
+    return a->menu == b->menu && a->node == b->node && a->start == b->start && a->depth == b->depth &&
+           !memcmp(a->history, b->history, sizeof(a->history));
+}
@@ -0,0 +1,136 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Menu_Store.h: Keeps where a menu frame is in EEPROM so it comes back at the same menu and node after a reset or
+| brownout. The frame's menu, cursor and history are saved once they have stayed the same for STORE_DELAY_MS, and each
+| save goes to the next of STORE_SLOTS records in turn so the writes are spread over the whole region.
+|
+| Record layout (one per slot, STORE_SLOTS slots from STORE_ADDRESS):
+|
+|   sequence (16) | size | menu | node | window start | depth | history (MAX_DEPTH) | CRC (16)
+|
+| The newest record is the one with the highest sequence number whose CRC checks out. The CRC is the CRC-16/CCITT used
+| by the remote protocol, over every byte before it. On the host, tools/host/EEPROM.h keeps the region in a file.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef MENU_STORE_H
+#define MENU_STORE_H
+
+#include "Simple_Menu_Scrolling.h"
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// --------------------------- /    \   / ___/  / ___/  /_  _/  / \  / /  / ___/  / ____/ ----------------------------- //
+// -------------------------- / /_\ /  / __/   / __/     / /   / /\\/ /  / __/    \__ \  ------------------------------ //
+// ------------------------- /_____/  /____/  /_/      /___/  /_/  \_/  /____/  /_____/ ------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+// First EEPROM address used and the number of records kept. Each slot is written once every STORE_SLOTS saves
+#ifndef STORE_ADDRESS
+#define STORE_ADDRESS   0
+#endif
+#ifndef STORE_SLOTS
+#define STORE_SLOTS     8
+#endif
+
+// Time (millis) the position has to stay the same before it is saved, so scrolling through a menu is one write
+#ifndef STORE_DELAY_MS
+#define STORE_DELAY_MS  2000
+#endif
+
+/*  ---------------------------------------------------------------------------------------------------------------------/
+|  -------------------------------------------------- RECORD CLASS -----------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuRecord: One saved position of a frame, exactly as it is written to a slot
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - size is the size of the record when it was written, so records left by a build with another MAX_DEPTH or index
+|   size are never taken for this one's
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuRecord
+{
+  public:
+
+  // Counts up by one with every save, so the newest record can be told apart from the older ones
+  unsigned short sequence;
+
+  unsigned char size;
+
+  // The frame's menu, selected node, window start and history
+  menuIndex menu;
+  menuIndex node;
+  menuIndex start;
+  unsigned char depth;
+  menuIndex history[MAX_DEPTH];
+
+  unsigned short crc;
+};
+
+// Bytes the store takes up in EEPROM
+#define STORE_BYTES     (STORE_SLOTS * sizeof(menuRecord))
+
+static_assert(STORE_SLOTS >= 2, "STORE_SLOTS needs at least two slots so a save never overwrites the newest record");
+static_assert(sizeof(menuRecord) < 256, "menuRecord doesn't fit its size byte, lower MAX_DEPTH");
+
+/*  ---------------------------------------------------------------------------------------------------------------------/
+|  -------------------------------------------------- STORE CLASS ------------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuStore: Saves and restores the position of one frame in a ring of EEPROM records. restore() is called once at
+| startup, after the menus are built and before the first newBuild, and poll() every pass of the loop.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - EEPROM.update only rewrites the bytes that differ, so on AVR a save mostly wears the sequence and CRC bytes
+| - On ESP32 and ESP8266 the EEPROM is kept in flash and commit() rewrites the whole sector, so there the delay is
+|   what saves the flash, not the slots
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuStore
+{
+  public:
+
+  // The frame being kept
+  menuFrame * frame;
+
+  // Slot and sequence number of the newest record
+  unsigned char slot = STORE_SLOTS - 1;
+  unsigned short sequence = 0;
+
+  // The position last saved, and the position the frame was at last poll
+  menuRecord saved;
+  menuRecord seen;
+
+  // Time (millis) the frame last moved, and whether it is somewhere other than the saved position
+  unsigned long changeTime = 0;
+  char pending = 0;
+
+  // Number of records written
+  unsigned long writeCount = 0;
+
+  menuStore(menuFrame * framePtr);
+
+  char restore();
+  char poll();
+  void save();
+
+  void capture(menuRecord * record);
+  char fits(const menuRecord * record);
+  void apply(const menuRecord * record);
+
+  static void read(unsigned char slotNum, menuRecord * record);
+  static void write(unsigned char slotNum, const menuRecord * record);
+  static unsigned short check(const menuRecord * record);
+  static char same(const menuRecord * a, const menuRecord * b);
+};
+
+#endif
@@ -7,7 +7,6 @@
 --------------------------------------------------------------------------------------------------------------------*/
 
 #include "Simple_Menu_Scrolling.h"
-#include "OLED_Tools.h"
 #include <Arduino.h>
 
 // -------------------------------------------------------------------------------------------------------------------- //
@@ -26,7 +25,7 @@
 |
 | - char type: the type of node; either a SUB node that directs to a menu, or an ACT node that links a function
 |
-| - void (*functPtr) (void): the pointer to the function to be activated, can be left as NULL if not an ACT node
+| - menuIndex call: the slot of the node's function in the tree's callback table, ignored if not an ACT node
 |        -------------------------------------------------------------------------------------------------------
 | Returns: nothing
 |
@@ -36,15 +35,17 @@
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
 | Date:       December 14,2022
-| Edited:     {Date}  
+| Edited:     October 19, 2026
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuNode::config(char * namePtr, char type, char (*functPtr) (void))
+void menuNode::config(const char * namePtr, char type, menuIndex call)
 {
     this->nodeType = type;
+    this->flags = 0;
+    this->context = 0;
 
     this->setName(namePtr);    
 
-    this->choose = functPtr;
+    this->target = call;
 }
 
 
@@ -73,12 +74,18 @@ void menuNode::del()
         this->name[i] = 0;
     }
 
-    this->choose = NULL;
+    this->flags = 0;
+    this->target = 0;
+    this->context = 0;
+
+#if MENU_ICONS
+    this->icon = 0;
+#endif
 }
 
 /*---------------------------------------------------------------------------------------------------------------------
 | menuNode::setName: Sets the name of the node. This is included as a separate function to allow users to dynamically
-| change the name of nodes if they desire. 
+| change the name of nodes if they desire. The display width of the name is worked out here, once, for scrolling.
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
 | - char * namePtr: the string pointer to the name of the node
@@ -93,16 +100,19 @@ void menuNode::del()
 | Date:       December 14,2022
 | Edited:     {Date}  
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuNode::setName(char * namePtr)
+void menuNode::setName(const char * namePtr)
 {
     strcpy(this->name, namePtr);
+
+    this->width = strlen(this->name) * CHAR_WIDTH;
+    this->flags &= ~NODE_TEXT;
 }
 
 /*---------------------------------------------------------------------------------------------------------------------
 | menuNode::link: Links the node to the menu it will open
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - char menuNum: the index of the menu that the node links to
+| - menuIndex menuNum: the index of the menu that the node links to
 |        -------------------------------------------------------------------------------------------------------
 | Returns: nothing
 |
@@ -114,122 +124,138 @@ void menuNode::setName(char * namePtr)
 | Date:       December 14,2022
 | Edited:     {Date}  
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuNode::link(char menuNum)
+void menuNode::link(menuIndex menuNum)
 {
     // Set the menu number within the node object
-    this->menuCall = menuNum;
+    this->target = menuNum;
 }
 
 
 // -------------------------------------------------------------------------------------------------------------------- //
-// -------------------------------------------------- MENU CLASS ------------------------------------------------------ //
+// --------------------------------------------- ICON READER CLASS ---------------------------------------------------- //
 // -------------------------------------------------------------------------------------------------------------------- //
 
+menuIconReader::menuIconReader(menuIcon icon)
+{
+    this->at = icon + 1;
+    this->left = pgm_read_byte(icon);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------
-| menu::addNode: Configures the next node in the current menu array. Sets the name, node type, and function (if wanted).
-| Increments the node count afterwards. This function is almost identical to the menuFrame version.
+| menuIconReader::next: Gives the next column of the icon, reading a new packet header from flash when the last packet
+| is used up
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - char * nodeName: The string pointer to the name of the node (will be displayed)
-|
-| - char nodeType: the type of node; either a SUB node that directs to a menu, or an ACT node that links a function
-|
-| - void (*functPtr) (void): the pointer to the function to be activated, can be left as NULL if not an ACT node
+| - N/A
 |        -------------------------------------------------------------------------------------------------------
-| Returns: nothing
+| Returns: the column's eight pixels, least significant bit at the top, or 0 once past the icon's width
 |
 |        -------------------------------------------------------------------------------------------------------
 | Notes/Future Changes:
-| - 
+| - At most two bytes are read from flash a column, so drawing an icon takes the same time whatever it looks like
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       {Date}
-| Edited:     {Date}  
+| Date:       October 19, 2026
+| Edited:     {Date}
 ----------------------------------------------------------------------------------------------------------------------*/
-void menu::addNode(char * nodeName, char nodeType, char (*functPtr) (void))
+unsigned char menuIconReader::next()
 {
-    node[nodeCount].config(nodeName, nodeType, functPtr);
+    if(!this->left)
+    {
+        return 0;
+    }
 
-    nodeCount++;
-}
+    this->left--;
 
+    if(!this->count)
+    {
+        unsigned char header = pgm_read_byte(this->at++);
 
-void menu::resetNodes()
-{
-    this->nodeCount = 0;
-}
+        this->repeat = header & 0x80;
+        this->count = header & 0x7F;
+
+        if(this->repeat)
+        {
+            this->value = pgm_read_byte(this->at++);
+        }
+    }
 
+    this->count--;
+    return this->repeat ? this->value : pgm_read_byte(this->at++);
+}
 
 /*---------------------------------------------------------------------------------------------------------------------
-| menu::delNode: deletes a menu node from the menu and shifts everything down
+| menuCrcStep: Adds one byte to a CRC-16/CCITT. Worked out bit by bit to save the 512 byte table.
+| Shared by the remote protocol and the stored records, so both check bytes the same way
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
+| - unsigned short crc: the CRC so far
+|
+| - unsigned char byte: the next byte
 |        -------------------------------------------------------------------------------------------------------
-| Returns: nothing
+| Returns: the new CRC
 |
 |        -------------------------------------------------------------------------------------------------------
 | Notes/Future Changes:
-| - 
+| -
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       January 14, 2023
-| Edited:     {Date}  
+| Date:       October 19, 2026
+| Edited:     {Date}
 ----------------------------------------------------------------------------------------------------------------------*/
-void menu::delNode(char nodeIndex)
+unsigned short menuCrcStep(unsigned short crc, unsigned char byte)
 {
-    if(this->nodeCount)
-    {
-        // Overwrite with other nodes in menu
-        if(nodeIndex < this->nodeCount-1)
-        {
-            for(int i = nodeIndex; i < this->nodeCount-1; i++)
-            {
-                this->node[i] = this->node[i+1];
-            }
-        }
-
-        else
-        {
-            this->node[nodeIndex].del();
-        }
+    crc ^= (unsigned short) byte << 8;
 
-        this->nodeCount--;
+    for(unsigned char i = 0; i < 8; i++)
+    {
+        crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
     }
 
+    return crc;
 }
 
 
+// -------------------------------------------------------------------------------------------------------------------- //
+// ------------------------------------------------- VALUE CLASS ------------------------------------------------------ //
+// -------------------------------------------------------------------------------------------------------------------- //
+
 /*---------------------------------------------------------------------------------------------------------------------
-| menu::setName: Sets/changes the name of the menu 
+| menuValue::adjust: Steps a number up or down by the value's step, keeping it within min and max
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - char * namePtr: the string pointer to the name of the menu
+| - long number: the number to step
+|
+| - char direction: 1 to step up, -1 to step down
 |        -------------------------------------------------------------------------------------------------------
-| Returns: nothing
+| Returns: the stepped number
 |
 |        -------------------------------------------------------------------------------------------------------
 | Notes/Future Changes:
 | - 
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       December 14,2022
+| Date:       October 19, 2026
 | Edited:     {Date}  
 ----------------------------------------------------------------------------------------------------------------------*/
-void menu::setName(char * namePtr)
+long menuValue::adjust(long number, char direction)
 {
-    // Take the name and input it into the class name array
-    strcpy(this->name, namePtr);
-}
+    if(direction > 0)
+    {
+        return number > this->max - this->step ? this->max : number + this->step;
+    }
 
+    return number < this->min + this->step ? this->min : number - this->step;
+}
 
 /*---------------------------------------------------------------------------------------------------------------------
-| menuFrame::addMenu: Initializes a menu object within the array inside the menuFrame object. You can manually set the
-| index for the menu 
+| menuValue::format: Writes a number as fixed point text, right aligned in VALUE_CHARS characters. Digits are worked
+| out from the right with divides by ten, so no printf or heap is needed. Numbers too long to fit lose their left end.
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - char * menuName: The string pointer for the menus name
+| - long number: the number to write, with the value's number of decimals
 |
-| - char index: The index for the menu within the menuFrame array
+| - char * out: where to write the text, at least VALUE_CHARS + 1 long
 |        -------------------------------------------------------------------------------------------------------
 | Returns: nothing
 |
@@ -238,125 +264,214 @@ void menu::setName(char * namePtr)
 | - 
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       December 14,2022
+| Date:       October 19, 2026
 | Edited:     {Date}  
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuFrame::addMenu (char * menuName, char index)
+void menuValue::format(long number, char * out)
 {
-    // Ensure that the index is valid within the specified number of menus allowed
-    if(index >= 0 && index <= MAX_MENUS)
+    unsigned long magnitude = number < 0 ? 0UL - (unsigned long) number : (unsigned long) number;
+    unsigned char digits = 0;
+    unsigned char pos = VALUE_CHARS;
+
+    out[pos] = 0;
+
+    // Always write every decimal and at least one digit in front of the point
+    while(pos > 0 && (magnitude || digits <= this->decimals))
     {
-        // Configure the name of the menu
-        menuList[index].setName(menuName);
+        if(this->decimals && digits == this->decimals)
+        {
+            out[--pos] = '.';
 
-        // Set the menu configuration index so that any nodes added afterwards are automatically associated with this men
-        configIndex = index;
+            if(!pos)
+            {
+                break;
+            }
+        }
+
+        out[--pos] = '0' + magnitude % 10;
+        magnitude /= 10;
+        digits++;
+    }
+
+    if(number < 0 && pos > 0)
+    {
+        out[--pos] = '-';
+    }
+
+    while(pos > 0)
+    {
+        out[--pos] = ' ';
+    }
+}
+
+#if NODE_PAGE
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// ---------------------------------------------- NODE PAGES CLASS ---------------------------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+menuPage menuNodes::pool[MENU_PAGES];
+unsigned short menuNodes::freed[MENU_PAGES];
+unsigned short menuNodes::freedCount = 0;
+unsigned short menuNodes::usedCount = 0;
+const menuNode menuNodes::EMPTY;
+menuNode menuNodes::scratch;
+
+menuNodes::menuNodes()
+{
+    for(unsigned short i = 0; i < PAGE_SLOTS; i++)
+    {
+        this->page[i] = NO_PAGE;
     }
+}
+
+menuNodes::menuNodes(const menuNodes & other) : menuNodes()
+{
+    *this = other;
+}
+
+menuNodes::menuNodes(menuNodes && other) : menuNodes()
+{
+    *this = static_cast<menuNodes &&>(other);
+}
 
+menuNodes::~menuNodes()
+{
+    this->release(0);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------
-| menuFrame::addNode: Adds a node to the most recently declared menu
+| menuNodes::operator=: Replaces the nodes with a copy of other's. The pages held are given back first, then a page is
+| taken for each one other holds and its nodes are copied in, so the two never share a page.
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - char * nodeName: The string pointer to the name of the node (will be displayed)
-|
-| - char nodeType: the type of node; either a SUB node that directs to a menu, or an ACT node that links a function
-|
-| - void (*functPtr) (void): the pointer to the function to be activated, can be left as NULL if not an ACT node
-|
+| - const menuNodes & other: the nodes to copy
 |        -------------------------------------------------------------------------------------------------------
-| Returns: nothing
+| Returns: this
 |
 |        -------------------------------------------------------------------------------------------------------
 | Notes/Future Changes:
-| - 
+| - If the pool runs out part way, the copy stops at the last page that fit and the nodes after it read as EMPTY
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       December 14,2022
-| Edited:     {Date}  
+| Date:       October 19, 2026
+| Edited:     {Date}
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuFrame::addNode(char * nodeName, char nodeType, char (*functPtr) (void))
+menuNodes & menuNodes::operator=(const menuNodes & other)
 {
-    // The menuFrame addNode function simply calls the menu::addNode function and passes down the arguments.
-    // This was done to allow the user to still be able to dynamically add nodes from the menu level if need be
-    this->menuList[configIndex].addNode(nodeName, nodeType, functPtr);
+    if(this == &other)
+    {
+        return *this;
+    }
 
-    // Updates the node link index so that when calling the linkNode function it automatically uses the last made node.
-    // This is done for usability and simplicity
-    this->nodeLinkIndex = this->menuList[configIndex].nodeCount - 1;
+    this->release(0);
+
+    for(unsigned short i = 0; i < PAGE_SLOTS && other.page[i] != NO_PAGE; i++)
+    {
+        if(!this->reserve((i + 1) * NODE_PAGE < MAX_NODES ? (i + 1) * NODE_PAGE : MAX_NODES))
+        {
+            break;
+        }
+
+        pool[this->page[i]] = pool[other.page[i]];
+    }
+
+    return *this;
 }
 
 /*---------------------------------------------------------------------------------------------------------------------
-| menuFrame::manAddNode: Adds a node to the menu of choice
+| menuNodes::operator=: Takes over other's pages, giving back the ones held before. other is left with none, so
+| assigning a new tree (tree = menuTree()) neither copies nodes nor loses pages.
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - char * nodeName: The string pointer to the name of the node (will be displayed)
-|
-| - char menuNum: The index of the menu you would like to add a node to
-|
-| - char nodeType: the type of node; either a SUB node that directs to a menu, or an ACT node that links a function
-|
-| - void (*functPtr) (void): the pointer to the function to be activated, can be left as NULL if not an ACT node
-|
+| - menuNodes && other: the nodes to take
 |        -------------------------------------------------------------------------------------------------------
-| Returns: nothing
+| Returns: this
 |
 |        -------------------------------------------------------------------------------------------------------
 | Notes/Future Changes:
 | - 
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       December 14,2022
-| Edited:     {Date}  
+| Date:       October 19, 2026
+| Edited:     {Date}
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuFrame::manAddNode(char * nodeName, char menuNum, char nodeType, char (*functPtr) (void))
+menuNodes & menuNodes::operator=(menuNodes && other)
 {
-    // The menuFrame addNode function simply calls the menu::addNode function and passes down the arguments.
-    // This was done to allow the user to still be able to dynamically add nodes from the menu level if need be
-    this->menuList[menuNum].addNode(nodeName, nodeType, functPtr);
+    if(this == &other)
+    {
+        return *this;
+    }
 
-    /*
-    // Updates the node link index so that when calling the linkNode function it automatically uses the last made node.
-    // This is done for usability and simplicity
-    this->nodeLinkIndex = this->menuList[configIndex].nodeCount - 1;
-    */
-}
+    this->release(0);
+
+    for(unsigned short i = 0; i < PAGE_SLOTS; i++)
+    {
+        this->page[i] = other.page[i];
+        other.page[i] = NO_PAGE;
+    }
 
+    return *this;
+}
 
 /*---------------------------------------------------------------------------------------------------------------------
-| menuFrame::delNode:
+| menuNodes::reserve: Makes sure the menu has pages for its first count nodes, taking any it is missing from the pool.
+| New pages start with every node unconfigured.
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
+| - menuIndex count: the number of nodes the menu needs room for
 |        -------------------------------------------------------------------------------------------------------
-| Returns: nothing
+| Returns: 1 if there is room for them all, 0 if count is over MAX_NODES or the pool ran out
 |
 |        -------------------------------------------------------------------------------------------------------
 | Notes/Future Changes:
-| - 
+| - Pages taken before the pool ran out are kept
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       January 16, 2023
-| Edited:     {Date}  
+| Date:       October 19, 2026
+| Edited:     {Date}
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuFrame::delNode(char menu, char node)
+char menuNodes::reserve(menuIndex count)
 {
-    this->menuList[menu].delNode(node);
-    if(this->nodeIndex > this->menuList[menu].nodeCount-1)
+    if(count > MAX_NODES)
+    {
+        return 0;
+    }
+
+    for(unsigned short i = 0; i < (count + NODE_PAGE - 1) / NODE_PAGE; i++)
     {
-        this->nodeIndex--;
-        this->arrowIndex--;
+        if(this->page[i] != NO_PAGE)
+        {
+            continue;
+        }
+
+        // Reuse a page given back before handing out a new one
+        if(freedCount)
+        {
+            this->page[i] = freed[--freedCount];
+        }
+
+        else if(usedCount < MENU_PAGES)
+        {
+            this->page[i] = usedCount++;
+        }
+
+        else
+        {
+            return 0;
+        }
+
+        pool[this->page[i]] = menuPage();
     }
-    //Something something delete last one visible causes issues
+
+    return 1;
 }
 
 /*---------------------------------------------------------------------------------------------------------------------
-| menuFrame::linkNode: Links a node to the menu it leads to, and also links that same menu back to the node that
-| triggers it
+| menuNodes::release: Gives the pages past the first count nodes back to the pool
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - char menuNum: the index of the menu you want to link to the node. This is also used as an index in the menFrame
-| object to link that menu back to the node
+| - menuIndex count: the number of nodes the menu still holds
 |        -------------------------------------------------------------------------------------------------------
 | Returns: nothing
 |
@@ -365,75 +480,113 @@ void menuFrame::delNode(char menu, char node)
 | - 
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       December 14,2022
-| Edited:     {Date}  
+| Date:       October 19, 2026
+| Edited:     {Date}
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuFrame::linkNode(char menuNum)
+void menuNodes::release(menuIndex count)
 {
-    // Add the menu a node directs to
-    this->menuList[configIndex].node[nodeLinkIndex].link(menuNum);
-
-    // Create a back reference to the parent node of a menu
-    this->menuList[menuNum].backLink[MENU] = this->configIndex;
-    this->menuList[menuNum].backLink[NODE] = this->nodeLinkIndex;
+    for(unsigned short i = (count + NODE_PAGE - 1) / NODE_PAGE; i < PAGE_SLOTS; i++)
+    {
+        if(this->page[i] != NO_PAGE)
+        {
+            freed[freedCount++] = this->page[i];
+            this->page[i] = NO_PAGE;
+        }
+    }
 }
 
 /*---------------------------------------------------------------------------------------------------------------------
-| menuFrame::up: Decrements the node index (decrementing moves it up the menu) 
+| menuNodes::needs, spare: The number of pages the menu would have to take to hold count nodes, and the number of
+| pages the pool has left. Used to check a whole menu fits before any of it is written.
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - 
+| - menuIndex count: the number of nodes
 |        -------------------------------------------------------------------------------------------------------
-| Returns: nothing
+| Returns: the number of pages
 |
 |        -------------------------------------------------------------------------------------------------------
 | Notes/Future Changes:
 | - 
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       December 14,2022
-| Edited:     {Date}  
+| Date:       October 19, 2026
+| Edited:     {Date}
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuFrame::up()
+unsigned short menuNodes::needs(menuIndex count)
 {
-    // If the index is greater than zero, decrement it (top choice is zero)
-    if(nodeIndex)
+    unsigned short missing = 0;
+
+    for(unsigned short i = 0; i < (count + NODE_PAGE - 1) / NODE_PAGE && i < PAGE_SLOTS; i++)
     {
-        this->nodeIndex--;
+        missing += this->page[i] == NO_PAGE;
     }
+
+    return missing;
+}
+
+unsigned short menuNodes::spare()
+{
+    return freedCount + MENU_PAGES - usedCount;
 }
 
+#endif
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// -------------------------------------------------- MENU CLASS ------------------------------------------------------ //
+// -------------------------------------------------------------------------------------------------------------------- //
+
 /*---------------------------------------------------------------------------------------------------------------------
-| menuFrame::down: Increments the node index (incrementing moves it down the menu) 
+| menu::addNode: Configures the next node in the current menu array. Sets the name, node type, and function (if wanted).
+| Increments the node count afterwards. This function is almost identical to the menuFrame version.
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - N/A
+| - char * nodeName: The string pointer to the name of the node (will be displayed)
+|
+| - char nodeType: the type of node; either a SUB node that directs to a menu, or an ACT node that links a function
+|
+| - menuIndex call: the callback table slot to be activated, ignored if not an ACT node
 |        -------------------------------------------------------------------------------------------------------
 | Returns: nothing
 |
 |        -------------------------------------------------------------------------------------------------------
 | Notes/Future Changes:
-| - 
+| - The node is left out if the menu is full, with paged storage if the pool has no page left for it, or if an ACT
+|   or NUM node has no slot (NO_SLOT)
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       December 14,2022
-| Edited:     {Date}  
+| Date:       {Date}
+| Edited:     October 19, 2026
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuFrame::down()
+void menu::addNode(char * nodeName, char nodeType, menuIndex call)
 {
-    // If the index is less than the menu size, then increment the index (last option is largest value)
-    if(nodeIndex < menuList[currentMenu].nodeCount - 1)
-    {    
-        this->nodeIndex++;
+    if((nodeType == ACT_NODE || nodeType == NUM_NODE) && call == NO_SLOT)
+    {
+        return;
+    }
+
+    if(!node.reserve(nodeCount + 1))
+    {
+        return;
     }
+
+    node.edit(nodeCount).config(nodeName, nodeType, call);
+
+    nodeCount++;
+}
+
+
+void menu::resetNodes()
+{
+    this->nodeCount = 0;
+    this->node.release(0);
 }
 
+
 /*---------------------------------------------------------------------------------------------------------------------
-| menuFrame::choose: Triggers the action associated with the current menu node. This action can be to open another
-| menu, or to trigger a linked function via function pointer.
+| menu::delNode: deletes a menu node from the menu and shifts everything down
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - N/A
+| - menuIndex nodeIndex: the node to delete, nothing is deleted if it is past the end of the menu
 |        -------------------------------------------------------------------------------------------------------
 | Returns: nothing
 |
@@ -442,38 +595,34 @@ void menuFrame::down()
 | - 
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       December 14, 2022
+| Date:       January 14, 2023
 | Edited:     {Date}  
 ----------------------------------------------------------------------------------------------------------------------*/
-char menuFrame::choose()
+void menu::delNode(menuIndex nodeIndex)
 {
-    // Depending on if the node triggers another menu, or a function:
-    switch(this->menuList[currentMenu].node[nodeIndex].nodeType)
+    if(nodeIndex < this->nodeCount)
     {
-        // Changes the current menu index and resets the node index to start at the top of the new menu
-        case SUB_NODE:
-        // Change the active menu to that of the node's linked menu number
-        this->currentMenu = this->menuList[currentMenu].node[nodeIndex].menuCall;
-        // Reset the choice index to zero
-        this->nodeIndex = 0;
-        this->arrowIndex = 0;
-        break;
+        // Overwrite with other nodes in menu
+        for(menuIndex i = nodeIndex; i < this->nodeCount-1; i++)
+        {
+            this->node.edit(i) = this->node[i+1];
+        }
 
-        // Triggers the function pointer associated with the menu node
-        case ACT_NODE:
-        // Activate the linked function for the node
-        return this->menuList[currentMenu].node[nodeIndex].choose();
-        
-        break;
+        // The last slot is now empty, whether it was the one deleted or moved down
+        this->node.edit(this->nodeCount-1).del();
+
+        this->nodeCount--;
+        this->node.release(this->nodeCount);
     }
+
 }
 
+
 /*---------------------------------------------------------------------------------------------------------------------
-| menuFrame::back: Returns to the previous menu if there is one. Also resets the node index to the node that triggered
-| the current menu.
+| menu::setName: Sets/changes the name of the menu 
 |        -------------------------------------------------------------------------------------------------------
 | Arguments:
-| - N/A
+| - char * namePtr: the string pointer to the name of the menu
 |        -------------------------------------------------------------------------------------------------------
 | Returns: nothing
 |
@@ -482,139 +631,2833 @@ char menuFrame::choose()
 | - 
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
-| Date:       December 14, 2022
+| Date:       December 14,2022
 | Edited:     {Date}  
 ----------------------------------------------------------------------------------------------------------------------*/
-void menuFrame::back()
+void menu::setName(const char * namePtr)
 {
-    //If the previous menu has less than the max amount of items that can fit on screen, 
-    // have the menu shown as normal
-    if(this->menuList[this->menuList[currentMenu].backLink[MENU]].nodeCount <= MAX_ITEMS)
-    {
-        this->menuStartIndex = 0;
-        this->nodeIndex = this->menuList[currentMenu].backLink[NODE];
-        this->arrowIndex = this->menuList[currentMenu].backLink[NODE];
+    // Take the name and input it into the class name array
+    strcpy(this->name, namePtr);
+    this->localized = 0;
+}
+
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// ------------------------------------------------ MENU TREE CLASS --------------------------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::menuTree: Clears the action statistics
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+menuTree::menuTree()
+{
+    memset(this->callCount, 0, sizeof(this->callCount));
+    memset(this->callTotal, 0, sizeof(this->callTotal));
+    memset(this->callWorst, 0, sizeof(this->callWorst));
+    memset(this->worstNode, 0, sizeof(this->worstNode));
+    memset(this->errorAt, 0, sizeof(this->errorAt));
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::addMenu: Initializes a menu object within the array inside the menuTree object. You can manually set the
+| index for the menu 
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - char * menuName: The string pointer for the menus name
+|
+| - menuIndex index: The index for the menu within the menuTree array
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       December 14,2022
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::addMenu (char * menuName, menuIndex index)
+{
+    // Ensure that the index is valid within the specified number of menus allowed
+    if(index < MAX_MENUS)
+    {
+        // Configure the name of the menu
+        menuList[index].setName(menuName);
+
+        // Set the menu configuration index so that any nodes added afterwards are automatically associated with this men
+        configIndex = index;
+    }
+
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::addNode: Adds a node to the most recently declared menu
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - char * nodeName: The string pointer to the name of the node (will be displayed)
+|
+| - char nodeType: the type of node; either a SUB node that directs to a menu, or an ACT node that links a function
+|
+| - void (*functPtr) (void): the pointer to the function to be activated, can be left as NULL if not an ACT node
+|
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - An ACT node is left out if the callback table is full, which validate() reports
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       December 14,2022
+| Edited:     October 19, 2026
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::addNode(char * nodeName, char nodeType, menuCallback functPtr)
+{
+    // Only ACT nodes take a slot in the callback table; a SUB node's target is set by linkNode
+    menuIndex call = nodeType == ACT_NODE ? this->addCallback(functPtr) : 0;
+
+    if(nodeType == ACT_NODE && call == NO_SLOT)
+    {
+        this->refuse(MENU_ERR_CALLS, configIndex);
+        return;
+    }
+
+    // The menuFrame addNode function simply calls the menu::addNode function and passes down the arguments.
+    // This was done to allow the user to still be able to dynamically add nodes from the menu level if need be
+    this->menuList[configIndex].addNode(nodeName, nodeType, call);
+
+    // Updates the node link index so that when calling the linkNode function it automatically uses the last made node.
+    // This is done for usability and simplicity
+    this->nodeLinkIndex = this->menuList[configIndex].nodeCount - 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::manAddNode: Adds a node to the menu of choice
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - char * nodeName: The string pointer to the name of the node (will be displayed)
+|
+| - menuIndex menuNum: The index of the menu you would like to add a node to
+|
+| - char nodeType: the type of node; either a SUB node that directs to a menu, or an ACT node that links a function
+|
+| - void (*functPtr) (void): the pointer to the function to be activated, can be left as NULL if not an ACT node
+|
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - An ACT node is left out if the callback table is full, which validate() reports
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       December 14,2022
+| Edited:     October 19, 2026
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::manAddNode(char * nodeName, menuIndex menuNum, char nodeType, menuCallback functPtr)
+{
+    // Only ACT nodes take a slot in the callback table; a SUB node's target is set by linkNode
+    menuIndex call = nodeType == ACT_NODE ? this->addCallback(functPtr) : 0;
+
+    if(nodeType == ACT_NODE && call == NO_SLOT)
+    {
+        this->refuse(MENU_ERR_CALLS, menuNum);
+        return;
+    }
+
+    // The menuFrame addNode function simply calls the menu::addNode function and passes down the arguments.
+    // This was done to allow the user to still be able to dynamically add nodes from the menu level if need be
+    this->menuList[menuNum].addNode(nodeName, nodeType, call);
+
+    /*
+    // Updates the node link index so that when calling the linkNode function it automatically uses the last made node.
+    // This is done for usability and simplicity
+    this->nodeLinkIndex = this->menuList[configIndex].nodeCount - 1;
+    */
+}
+
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::linkNode: Links a node to the menu it leads to, and also links that same menu back to the node that
+| triggers it
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex menuNum: the index of the menu you want to link to the node. This is also used as an index in the menuTree
+| object to link that menu back to the node
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       December 14,2022
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::linkNode(menuIndex menuNum)
+{
+    // Add the menu a node directs to
+    this->menuList[configIndex].node.edit(nodeLinkIndex).link(menuNum);
+
+    // Create a back reference to the parent node of a menu. A link to a menu that doesn't exist is left for validate()
+    // to report
+    if(menuNum < MAX_MENUS)
+    {
+        this->menuList[menuNum].backLink[MENU] = this->configIndex;
+        this->menuList[menuNum].backLink[NODE] = this->nodeLinkIndex;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::addCallback: Finds the slot of a function in the callback table, adding it if it is not there yet. Nodes
+| store the slot instead of the pointer, so a function shared by many nodes is only stored once.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuCallback functPtr: the function to look up, may be NULL
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the slot of the function, or NO_SLOT if the table is full
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+menuIndex menuTree::addCallback(menuCallback functPtr)
+{
+    return this->addAction(menuAction(functPtr));
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::addHandler: Finds the slot of a handler in the callback table, adding it if it is not there yet. However
+| many nodes share the handler, it takes one slot.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuHandler handler: the handler to look up
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the slot of the handler, or NO_SLOT if the table is full
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+menuIndex menuTree::addHandler(menuHandler handler)
+{
+    return this->addAction(menuAction(handler));
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::addAction: Finds the slot of a plain function or handler in the callback table, adding it if it is not
+| there yet. Used by addCallback and addHandler, and by buildMenu for declared nodes.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuAction action: the function to look up
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the slot of the function, or NO_SLOT if the table is full
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - The same function added once as a plain function and once as a handler takes two slots
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+menuIndex menuTree::addAction(menuAction action)
+{
+    // Reuse the slot if the function is already in the table
+    for(menuIndex i = 0; i < this->callbackCount; i++)
+    {
+        if(this->callbacks[i] == action)
+        {
+            return i;
+        }
+    }
+
+    if(this->callbackCount < MAX_CALLBACKS)
+    {
+        this->callbacks[callbackCount] = action;
+        return this->callbackCount++;
+    }
+
+    return NO_SLOT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::refuse: Notes that a node was left out of a menu because a table was full, so validate() can report it.
+| Only the first one is kept.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - char status: MENU_ERR_CALLS or MENU_ERR_VALUES
+|
+| - menuIndex menuNum: the menu the node was being added to
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::refuse(char status, menuIndex menuNum)
+{
+    if(this->refused == MENU_OK)
+    {
+        this->refused = status;
+        this->refusedAt[MENU] = menuNum;
+        this->refusedAt[NODE] = this->menuList[menuNum].nodeCount;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::addNode: Adds an ACT node to the most recently declared menu that triggers a shared handler. The handler
+| is called with the node's menu, index and context, so one function can serve a whole family of nodes.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - const char * nodeName: The string pointer to the name of the node (will be displayed)
+|
+| - menuHandler handler: the function to call when the node is chosen
+|
+| - unsigned char context: the value passed to the handler for this node, e.g. a channel number
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - The node is left out if the callback table is full, which validate() reports
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::addNode(const char * nodeName, menuHandler handler, unsigned char context)
+{
+    menu * target = &this->menuList[configIndex];
+    menuIndex call = this->addHandler(handler);
+    menuIndex count = target->nodeCount;
+
+    if(call == NO_SLOT)
+    {
+        this->refuse(MENU_ERR_CALLS, configIndex);
+        return;
+    }
+
+    target->addNode((char *) nodeName, ACT_NODE, call);
+
+    // Nothing more to do if the menu was full
+    if(target->nodeCount == count)
+    {
+        return;
+    }
+
+    menuNode & added = target->node.edit(target->nodeCount - 1);
+
+    added.flags |= NODE_HANDLER;
+    added.context = context;
+
+    this->nodeLinkIndex = target->nodeCount - 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::runAction: Runs the function of an ACT node and times it. The time is added to the statistics of the
+| node's callback slot, along with the node if it is the slot's slowest run so far. If the run took longer than
+| actionBudget, overrun is called with the node so the culprit can be found without a debugger.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex menuNum: the menu of the node
+|
+| - menuIndex nodeNum: the index of the node within the menu
+|        -------------------------------------------------------------------------------------------------------
+| Returns: what the node's function returned, or 0 if it has none
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - The time includes anything the function does, including interrupts that happen while it runs
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuTree::runAction(menuIndex menuNum, menuIndex nodeNum)
+{
+    const menuNode * node = &this->menuList[menuNum].node[nodeNum];
+    menuIndex slot = node->target;
+    menuAction action = this->callbacks[slot];
+
+    if(action.empty())
+    {
+        return 0;
+    }
+
+    // Handlers are told which node called them, plain functions are called as they were given
+    unsigned long start = micros();
+    char result = action.isHandler ? action.handler(menuNum, nodeNum, node->context) : action.call();
+    unsigned long time = micros() - start;
+
+    if(this->callCount[slot] < 0xFFFF)
+    {
+        this->callCount[slot]++;
+        this->callTotal[slot] += time;
+    }
+
+    if(time > this->callWorst[slot])
+    {
+        this->callWorst[slot] = time;
+        this->worstNode[slot][MENU] = menuNum;
+        this->worstNode[slot][NODE] = nodeNum;
+    }
+
+    if(this->actionBudget && time > this->actionBudget)
+    {
+        this->overrunCount++;
+
+        if(this->overrun)
+        {
+            this->overrun(menuNum, nodeNum, time);
+        }
+    }
+
+    return result;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::printActions: Prints the run time statistics of every callback slot, one per line as
+| "<slot> <calls> <average us> <worst us> <menu>:<node> <node name>" where the node is the one behind the worst run
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - Print * out: where to print the report, usually &Serial
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::printActions(Print * out)
+{
+    out->println("slot calls avg_us worst_us worst_node");
+
+    for(menuIndex i = 0; i < this->callbackCount; i++)
+    {
+        out->print((unsigned) i);
+        out->print(" ");
+        out->print((unsigned) this->callCount[i]);
+        out->print(" ");
+        out->print(this->callCount[i] ? this->callTotal[i] / this->callCount[i] : 0UL);
+        out->print(" ");
+        out->print(this->callWorst[i]);
+        out->print(" ");
+        out->print((unsigned) this->worstNode[i][MENU]);
+        out->print(":");
+        out->print((unsigned) this->worstNode[i][NODE]);
+        out->print(" ");
+        char label[MAX_CHAR];
+        out->println(this->nodeName(worstNode[i][MENU], worstNode[i][NODE], label));
+    }
+
+    out->print("overruns ");
+    out->println(this->overrunCount);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::addValue: Adds a NUM node to the most recently declared menu. The node shows the value at the end of its
+| row; choosing it starts editing, up and down step the value, and choosing again commits it.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - const char * nodeName: The string pointer to the name of the node (will be displayed)
+|
+| - menuValue * value: the value to show and edit. It must stay valid for as long as the tree is used
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - The node is left out if the value table is full, which validate() reports
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::addValue(const char * nodeName, menuValue * value)
+{
+    menuIndex slot = this->addValueSlot(value);
+
+    if(slot == NO_SLOT)
+    {
+        this->refuse(MENU_ERR_VALUES, configIndex);
+        return;
+    }
+
+    this->menuList[configIndex].addNode((char *) nodeName, NUM_NODE, slot);
+
+    this->nodeLinkIndex = this->menuList[configIndex].nodeCount - 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::addValueSlot: Finds the slot of a value in the value table, adding it if it is not there yet
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuValue * value: the value to look up
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the slot of the value, or NO_SLOT if the table is full
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+menuIndex menuTree::addValueSlot(menuValue * value)
+{
+    for(menuIndex i = 0; i < this->valueCount; i++)
+    {
+        if(this->values[i] == value)
+        {
+            return i;
+        }
+    }
+
+    if(this->valueCount < MAX_VALUES)
+    {
+        this->values[valueCount] = value;
+        return this->valueCount++;
+    }
+
+    return NO_SLOT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::buildMenu: Builds a whole menu from a declared list of nodes in one call. Everything is checked before
+| anything is written, so a bad declaration leaves the tree as it was instead of writing past the end of an array.
+| SUB nodes are linked, and linked back to, as they are written.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex index: the index of the menu to build, any nodes already in it are replaced
+|
+| - const menuDef * def: the name and nodes of the menu
+|        -------------------------------------------------------------------------------------------------------
+| Returns: MENU_OK, or the MENU_ERR_ code of the first problem found
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuTree::buildMenu(menuIndex index, const menuDef * def)
+{
+    if(index >= MAX_MENUS)
+    {
+        return MENU_ERR_INDEX;
+    }
+
+    char status = this->checkMenu(def, MAX_MENUS);
+
+    if(status != MENU_OK)
+    {
+        return status;
+    }
+
+    if(this->callbackCount + this->newCallbacks(def, 1) > MAX_CALLBACKS)
+    {
+        return MENU_ERR_CALLS;
+    }
+
+    if(this->valueCount + this->newValues(def, 1) > MAX_VALUES)
+    {
+        return MENU_ERR_VALUES;
+    }
+
+    if(this->menuList[index].node.needs(def->nodeCount) > menuNodes::spare())
+    {
+        return MENU_ERR_NODES;
+    }
+
+    this->writeMenu(index, def);
+
+    return MENU_OK;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::buildTree: Builds every menu of the tree from an array of declared menus, where the position in the array
+| is the menu's index. All menus are checked first, including that SUB nodes only link to menus in the array, and then
+| written in one pass.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - const menuDef * defs: the menus, in index order
+|
+| - menuIndex menuCount: the number of menus in the array
+|        -------------------------------------------------------------------------------------------------------
+| Returns: MENU_OK, or the MENU_ERR_ code of the first problem found
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuTree::buildTree(const menuDef * defs, menuIndex menuCount)
+{
+    if(menuCount > MAX_MENUS)
+    {
+        return MENU_ERR_INDEX;
+    }
+
+    for(menuIndex i = 0; i < menuCount; i++)
+    {
+        char status = this->checkMenu(&defs[i], menuCount);
+
+        if(status != MENU_OK)
+        {
+            return status;
+        }
+    }
+
+    if(this->callbackCount + this->newCallbacks(defs, menuCount) > MAX_CALLBACKS)
+    {
+        return MENU_ERR_CALLS;
+    }
+
+    if(this->valueCount + this->newValues(defs, menuCount) > MAX_VALUES)
+    {
+        return MENU_ERR_VALUES;
+    }
+
+    // Pages given back by menus that shrink aren't counted on, so every menu can take its pages in turn
+    unsigned long pages = 0;
+
+    for(menuIndex i = 0; i < menuCount; i++)
+    {
+        pages += this->menuList[i].node.needs(defs[i].nodeCount);
+    }
+
+    if(pages > menuNodes::spare())
+    {
+        return MENU_ERR_NODES;
+    }
+
+    for(menuIndex i = 0; i < menuCount; i++)
+    {
+        this->writeMenu(i, &defs[i]);
+    }
+
+    return MENU_OK;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::checkMenu: Checks that a declared menu fits in the tree: the node count, the length of every name, the
+| node types, that SUB nodes link to a menu below menuLimit and that NUM nodes have a value
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - const menuDef * def: the menu to check
+|
+| - menuIndex menuLimit: SUB nodes must link to a menu index lower than this
+|        -------------------------------------------------------------------------------------------------------
+| Returns: MENU_OK, or the MENU_ERR_ code of the first problem found
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuTree::checkMenu(const menuDef * def, menuIndex menuLimit)
+{
+    if(def->nodeCount > MAX_NODES)
+    {
+        return MENU_ERR_NODES;
+    }
+
+    if(def->name && strlen(def->name) >= MAX_CHAR)
+    {
+        return MENU_ERR_NAME;
+    }
+
+    for(menuIndex i = 0; i < def->nodeCount; i++)
+    {
+        const menuNodeDef * node = &def->nodes[i];
+
+        if(node->name && strlen(node->name) >= MAX_CHAR)
+        {
+            return MENU_ERR_NAME;
+        }
+
+        if(node->type != SUB_NODE && node->type != ACT_NODE && node->type != NUM_NODE)
+        {
+            return MENU_ERR_TYPE;
+        }
+
+        if(node->type == NUM_NODE && node->value == NULL)
+        {
+            return MENU_ERR_VALUES;
+        }
+
+        if(node->type == SUB_NODE && node->link >= menuLimit)
+        {
+            return MENU_ERR_LINK;
+        }
+    }
+
+    return MENU_OK;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::newCallbacks: Counts the functions in a set of declared menus that are not in the callback table yet,
+| counting a function used by several nodes only once
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - const menuDef * defs: the menus to look through
+|
+| - menuIndex menuCount: the number of menus in the array
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the number of callback slots the menus would add
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+menuIndex menuTree::newCallbacks(const menuDef * defs, menuIndex menuCount)
+{
+    menuIndex count = 0;
+
+    for(menuIndex m = 0; m < menuCount; m++)
+    {
+        for(menuIndex n = 0; n < defs[m].nodeCount; n++)
+        {
+            if(defs[m].nodes[n].type != ACT_NODE)
+            {
+                continue;
+            }
+
+            menuAction action = defs[m].nodes[n].slot();
+            char found = 0;
+
+            // Already in the table
+            for(menuIndex i = 0; i < this->callbackCount && !found; i++)
+            {
+                found = this->callbacks[i] == action;
+            }
+
+            // Or used by an earlier node of the declaration
+            for(menuIndex pm = 0; pm <= m && !found; pm++)
+            {
+                menuIndex last = pm == m ? n : defs[pm].nodeCount;
+
+                for(menuIndex pn = 0; pn < last && !found; pn++)
+                {
+                    found = defs[pm].nodes[pn].type == ACT_NODE && defs[pm].nodes[pn].slot() == action;
+                }
+            }
+
+            if(!found)
+            {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::newValues: Counts the NUM node values in a set of declared menus that are not in the value table yet,
+| counting a value shared by several nodes only once
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - const menuDef * defs: the menus to look through
+|
+| - menuIndex menuCount: the number of menus in the array
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the number of value slots the menus would add
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+menuIndex menuTree::newValues(const menuDef * defs, menuIndex menuCount)
+{
+    menuIndex count = 0;
+
+    for(menuIndex m = 0; m < menuCount; m++)
+    {
+        for(menuIndex n = 0; n < defs[m].nodeCount; n++)
+        {
+            if(defs[m].nodes[n].type != NUM_NODE)
+            {
+                continue;
+            }
+
+            menuValue * value = defs[m].nodes[n].value;
+            char found = 0;
+
+            for(menuIndex i = 0; i < this->valueCount && !found; i++)
+            {
+                found = this->values[i] == value;
+            }
+
+            for(menuIndex pm = 0; pm <= m && !found; pm++)
+            {
+                menuIndex last = pm == m ? n : defs[pm].nodeCount;
+
+                for(menuIndex pn = 0; pn < last && !found; pn++)
+                {
+                    found = defs[pm].nodes[pn].type == NUM_NODE && defs[pm].nodes[pn].value == value;
+                }
+            }
+
+            if(!found)
+            {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::writeMenu: Writes a declared menu into the tree without checking it. Nodes are written one after the
+| other from the start of the menu, and any left over from an earlier, longer menu are cleared.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex index: the index of the menu to write
+|
+| - const menuDef * def: the menu, already checked with checkMenu
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::writeMenu(menuIndex index, const menuDef * def)
+{
+    menu * target = &this->menuList[index];
+
+    this->configIndex = index;
+    target->node.reserve(def->nodeCount);
+
+    if(def->name)
+    {
+        target->setName(def->name);
+    }
+
+    else
+    {
+        this->titleText(def->text);
+    }
+
+    for(menuIndex i = 0; i < def->nodeCount; i++)
+    {
+        const menuNodeDef * node = &def->nodes[i];
+        const char * name = node->name ? node->name : "";
+
+        if(node->type == SUB_NODE)
+        {
+            target->node.edit(i).config(name, SUB_NODE, node->link);
+
+            // Link the menu back to the node that opens it
+            this->menuList[node->link].backLink[MENU] = index;
+            this->menuList[node->link].backLink[NODE] = i;
+        }
+
+        else if(node->type == NUM_NODE)
+        {
+            target->node.edit(i).config(name, NUM_NODE, this->addValueSlot(node->value));
+        }
+
+        else
+        {
+            target->node.edit(i).config(name, ACT_NODE, this->addAction(node->slot()));
+
+            if(node->handler)
+            {
+                target->node.edit(i).flags |= NODE_HANDLER;
+                target->node.edit(i).context = node->context;
+            }
+        }
+
+        if(!node->name)
+        {
+            this->nodeLinkIndex = i;
+            this->nameText(node->text);
+        }
+
+#if MENU_ICONS
+        target->node.edit(i).icon = node->icon;
+#endif
+    }
+
+    for(menuIndex i = def->nodeCount; i < target->nodeCount; i++)
+    {
+        target->node.edit(i).del();
+    }
+
+    target->nodeCount = def->nodeCount;
+    target->node.release(def->nodeCount);
+
+    // Leave the configuration indices on this menu so addNode and linkNode carry on from it
+    this->configIndex = index;
+    this->nodeLinkIndex = def->nodeCount ? def->nodeCount - 1 : 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::validate: Checks the whole tree once it is built, so navigation can trust it: every SUB node opens a menu
+| that exists and has nodes, every ACT and NUM node uses a slot that is filled, every menu with nodes can be reached
+| from menu 0, and no node was left out because its table was full. Meant to be called once at startup, after the
+| menus are added.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: MENU_OK, or the MENU_ERR_ code of the first problem found. errorAt holds the menu and node it was found at
+| (the node is 0 for an unreached menu)
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Menus are visited from menu 0 along SUB links, so each node is looked at once
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuTree::validate()
+{
+    // A node left out because a table was full is never in the tree to be found, so it is reported first
+    if(this->refused != MENU_OK)
+    {
+        this->errorAt[MENU] = this->refusedAt[MENU];
+        this->errorAt[NODE] = this->refusedAt[NODE];
+        return this->refused;
+    }
+
+    // Menus found so far, and the ones found but not looked through yet
+    unsigned char reached[(MAX_MENUS + 7) / 8];
+    menuIndex waiting[MAX_MENUS];
+    menuIndex waitCount = 1;
+
+    memset(reached, 0, sizeof(reached));
+    reached[0] = 1;
+    waiting[0] = 0;
+
+    while(waitCount)
+    {
+        menuIndex m = waiting[--waitCount];
+
+        for(menuIndex n = 0; n < this->menuList[m].nodeCount; n++)
+        {
+            const menuNode * node = &this->menuList[m].node[n];
+            char status = MENU_OK;
+
+            this->errorAt[MENU] = m;
+            this->errorAt[NODE] = n;
+
+            if(node->nodeType == SUB_NODE)
+            {
+                if(node->target >= MAX_MENUS || !this->menuList[node->target].nodeCount)
+                {
+                    status = MENU_ERR_LINK;
+                }
+
+                else if(!(reached[node->target / 8] & (1 << node->target % 8)))
+                {
+                    reached[node->target / 8] |= 1 << node->target % 8;
+                    waiting[waitCount++] = node->target;
+                }
+            }
+
+            else if(node->nodeType == ACT_NODE && (node->target >= this->callbackCount || this->callbacks[node->target].empty()))
+            {
+                status = MENU_ERR_CALLS;
+            }
+
+            else if(node->nodeType == NUM_NODE && (node->target >= this->valueCount || !this->values[node->target]))
+            {
+                status = MENU_ERR_VALUES;
+            }
+
+            if(status != MENU_OK)
+            {
+                return status;
+            }
+        }
+    }
+
+    for(menuIndex m = 0; m < MAX_MENUS; m++)
+    {
+        if(this->menuList[m].nodeCount && !(reached[m / 8] & (1 << m % 8)))
+        {
+            this->errorAt[MENU] = m;
+            this->errorAt[NODE] = 0;
+            return MENU_ERR_UNREACHED;
+        }
+    }
+
+    return MENU_OK;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::setLanguage: Switches every label given as a string ID over to another language. Only the table pointer
+| changes: the strings stay in flash and are looked up as they are drawn, so each language costs no RAM. Frames see
+| the new labels in their frame signature and redraw on their next build.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuLanguage table: the language table in flash, listing its strings in the same order as every other language
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - The width of each localized label is worked out again here so scrolling still never measures while drawing
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::setLanguage(menuLanguage table)
+{
+    this->language = table;
+
+    for(menuIndex m = 0; m < MAX_MENUS; m++)
+    {
+        for(menuIndex n = 0; n < this->menuList[m].nodeCount; n++)
+        {
+            menuNode * node = &this->menuList[m].node.edit(n);
+
+            if(node->flags & NODE_TEXT)
+            {
+                node->width = this->textWidth(node->text);
+            }
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::nameText: Gives the most recently added node a label from the language table instead of a name held in
+| RAM
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned short text: the string ID of the label
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::nameText(unsigned short text)
+{
+    menuNode * node = &this->menuList[configIndex].node.edit(nodeLinkIndex);
+
+    node->text = text;
+    node->flags |= NODE_TEXT;
+    node->width = this->textWidth(text);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::titleText: Gives the most recently added menu a title from the language table instead of a name held in
+| RAM
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned short text: the string ID of the title
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::titleText(unsigned short text)
+{
+    this->menuList[configIndex].text = text;
+    this->menuList[configIndex].localized = 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::textWidth: Gives the display width of a string in the current language, as it will be drawn
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned short text: the string ID to measure
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the width of the string, 0 if no language is set
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+unsigned char menuTree::textWidth(unsigned short text)
+{
+    char buffer[MAX_CHAR];
+
+    return strlen(this->lookup(text, buffer)) * CHAR_WIDTH;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::lookup: Copies a string of the current language out of flash so it can be drawn. Strings longer than a
+| name are cut to MAX_CHAR - 1 characters.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned short text: the string ID to look up
+|
+| - char * buffer: MAX_CHAR characters to copy the string into, usually on the caller's stack
+|        -------------------------------------------------------------------------------------------------------
+| Returns: buffer, holding an empty string if no language is set
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char * menuTree::lookup(unsigned short text, char * buffer)
+{
+    buffer[0] = 0;
+
+    if(this->language)
+    {
+        strncpy_P(buffer, (const char *) pgm_read_ptr(&this->language[text]), MAX_CHAR - 1);
+        buffer[MAX_CHAR - 1] = 0;
+    }
+
+    return buffer;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::nodeName: Gives the label of a node as it should be drawn, whether its name is held in RAM or looked up in
+| the language table
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex menuNum: the menu the node is in
+|
+| - menuIndex nodeNum: the node
+|
+| - char * buffer: MAX_CHAR characters a looked up label is copied into
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the node's own name, or buffer holding the label in the current language
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+const char * menuTree::nodeName(menuIndex menuNum, menuIndex nodeNum, char * buffer)
+{
+    const menuNode * node = &this->menuList[menuNum].node[nodeNum];
+
+    return node->flags & NODE_TEXT ? this->lookup(node->text, buffer) : node->name;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::menuName: Gives the title of a menu as it should be drawn, whether its name is held in RAM or looked up in
+| the language table
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex menuNum: the menu
+|
+| - char * buffer: MAX_CHAR characters a looked up title is copied into
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the menu's own name, or buffer holding the title in the current language
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char * menuTree::menuName(menuIndex menuNum, char * buffer)
+{
+    menu * target = &this->menuList[menuNum];
+
+    return target->localized ? this->lookup(target->text, buffer) : target->name;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::setIcons: Sets the table node icon slots are looked up in. Like a language, only the pointer is kept and
+| the icons stay in flash; frames see the change in their frame signature and redraw on their next build.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIconTable table: the icon table in flash
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::setIcons(menuIconTable table)
+{
+    this->icons = table;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::setIcon: Gives the most recently added node an icon from the icon table
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned char icon: the index of the icon in the table plus one, 0 to take the node's icon away
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Does nothing unless MENU_ICONS is set, since nodes have no icon slot without it
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuTree::setIcon(unsigned char icon)
+{
+#if MENU_ICONS
+    this->menuList[configIndex].node.edit(nodeLinkIndex).icon = icon;
+#else
+    (void) icon;
+#endif
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::nodeIcon: Gives the icon a node should be drawn with
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex menuNum, nodeNum: the menu, and the node in it
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the icon in flash, or NULL if the node has none or no icon table is set
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+menuIcon menuTree::nodeIcon(menuIndex menuNum, menuIndex nodeNum)
+{
+#if MENU_ICONS
+    unsigned char icon = this->menuList[menuNum].node[nodeNum].icon;
+
+    if(icon && this->icons)
+    {
+        return (menuIcon) pgm_read_ptr(&this->icons[icon - 1]);
+    }
+#else
+    (void) menuNum;
+    (void) nodeNum;
+#endif
+
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuTree::labelChars: Gives the number of label characters that fit on a node's row, which is fewer when the
+| display draws an icon in front of the label
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex menuNum, nodeNum: the menu, and the node in it
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the characters of the label shown at once
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+unsigned char menuTree::labelChars(menuIndex menuNum, menuIndex nodeNum)
+{
+    return this->nodeIcon(menuNum, nodeNum) ? LABEL_CHARS - ICON_CHARS : LABEL_CHARS;
+}
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// ------------------------------------------------ MENU QUEUE CLASS -------------------------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuQueue::setName, setTitle, delNode, addNode: Queue a change to a node's label, a menu's title, the removal of a
+| node or a new node, to be made by the frame at its next newBuild. Safe to call from an interrupt or another task,
+| and never wait. Names longer than MAX_CHAR - 1 are cut short.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex menuNum, nodeNum: the menu, and the node in it, the change is made to
+|
+| - const char * nodeName, menuName: the new label or title, copied into the queue
+|
+| - char nodeType, menuCallback functPtr: as for menuTree::manAddNode
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if the edit was queued, 0 if the queue was full and it was dropped
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Nodes are looked up when the edit is applied, so a node number is taken after the edits queued before it
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+char menuQueue::setName(menuIndex menuNum, menuIndex nodeNum, const char * nodeName)
+{
+    menuEdit * edit = this->reserve(EDIT_NODE_NAME, menuNum, nodeNum);
+
+    if(!edit)
+    {
+        return 0;
+    }
+
+    strncpy(edit->name, nodeName, MAX_CHAR - 1);
+    this->publish();
+
+    return 1;
+}
+
+char menuQueue::setTitle(menuIndex menuNum, const char * menuName)
+{
+    menuEdit * edit = this->reserve(EDIT_MENU_NAME, menuNum, 0);
+
+    if(!edit)
+    {
+        return 0;
+    }
+
+    strncpy(edit->name, menuName, MAX_CHAR - 1);
+    this->publish();
+
+    return 1;
+}
+
+char menuQueue::delNode(menuIndex menuNum, menuIndex nodeNum)
+{
+    if(!this->reserve(EDIT_DEL_NODE, menuNum, nodeNum))
+    {
+        return 0;
+    }
+
+    this->publish();
+
+    return 1;
+}
+
+char menuQueue::addNode(const char * nodeName, menuIndex menuNum, char nodeType, menuCallback functPtr)
+{
+    menuEdit * edit = this->reserve(EDIT_ADD_NODE, menuNum, 0);
+
+    if(!edit)
+    {
+        return 0;
+    }
+
+    strncpy(edit->name, nodeName, MAX_CHAR - 1);
+    edit->nodeType = nodeType;
+    edit->action = functPtr;
+    this->publish();
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuQueue::reserve: Finds the slot the producer's next edit goes in and starts filling it. The consumer can't see
+| it until publish() is called.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned char code: the EDIT_ code of the edit
+|
+| - menuIndex menuNum, nodeNum: where it applies
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the slot, or NULL if the queue is full
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Producer side only
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+menuEdit * menuQueue::reserve(unsigned char code, menuIndex menuNum, menuIndex nodeNum)
+{
+    // The counts wrap at 256, so their difference is the number of edits waiting
+    if((unsigned char) (this->head - __atomic_load_n(&this->tail, __ATOMIC_ACQUIRE)) >= QUEUE_SIZE)
+    {
+        this->dropped++;
+        return NULL;
+    }
+
+    menuEdit * edit = &this->edits[this->head & (QUEUE_SIZE - 1)];
+
+    memset(edit, 0, sizeof(menuEdit));
+    edit->code = code;
+    edit->menuNum = menuNum;
+    edit->nodeNum = nodeNum;
+
+    return edit;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuQueue::publish: Hands the edit filled since reserve() to the consumer
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - The store is a release, so the consumer never sees the new head before the edit it covers
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+void menuQueue::publish()
+{
+    __atomic_store_n(&this->head, (unsigned char) (this->head + 1), __ATOMIC_RELEASE);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuQueue::apply: Makes every waiting edit to the tree, oldest first. Edits that point outside the tree, or would
+| add a node to a full menu, are skipped.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuTree * tree: the tree to change
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the number of edits taken off the queue
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Consumer side only. Edits queued while this runs wait for the next call
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+----------------------------------------------------------------------------------------------------------------------*/
+unsigned char menuQueue::apply(menuTree * tree)
+{
+    unsigned char end = __atomic_load_n(&this->head, __ATOMIC_ACQUIRE);
+    unsigned char count = 0;
+
+    for(unsigned char at = this->tail; at != end; at++, count++)
+    {
+        menuEdit * edit = &this->edits[at & (QUEUE_SIZE - 1)];
+
+        if(edit->menuNum >= MAX_MENUS)
+        {
+            continue;
+        }
+
+        menu * target = &tree->menuList[edit->menuNum];
+
+        switch(edit->code)
+        {
+            case EDIT_NODE_NAME:
+            if(edit->nodeNum < target->nodeCount)
+            {
+                target->node.edit(edit->nodeNum).setName(edit->name);
+            }
+            break;
+
+            case EDIT_MENU_NAME:
+            target->setName(edit->name);
+            break;
+
+            case EDIT_DEL_NODE:
+            if(edit->nodeNum < target->nodeCount)
+            {
+                target->delNode(edit->nodeNum);
+            }
+            break;
+
+            case EDIT_ADD_NODE:
+            if(target->nodeCount < MAX_NODES)
+            {
+                tree->manAddNode(edit->name, edit->menuNum, edit->nodeType, edit->action);
+            }
+            break;
+        }
+    }
+
+    // The slots are only given back once they have been read
+    __atomic_store_n(&this->tail, end, __ATOMIC_RELEASE);
+
+    return count;
+}
+
+// -------------------------------------------------------------------------------------------------------------------- //
+// ------------------------------------------------ MENUFRAME CLASS --------------------------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::menuFrame: Creates a viewer over a menu tree. Any number of frames can share one tree, each with its own
+| cursor, history and display. Changes made to the tree are seen by all of them.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuTree * treePtr: the menu tree to browse
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+menuFrame::menuFrame(menuTree * treePtr)
+{
+    this->tree = treePtr;
+
+    memset(this->latencyHist, 0, sizeof(this->latencyHist));
+    memset(this->savedNode, 0, sizeof(this->savedNode));
+    memset(this->savedStart, 0, sizeof(this->savedStart));
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::addMenu, addNode, manAddNode, linkNode, addValue: Pass configuration straight down to the shared tree so menus can
+| still be built through the frame. See the menuTree versions for details.
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::addMenu (char * menuName, menuIndex index)
+{
+    this->tree->addMenu(menuName, index);
+}
+
+void menuFrame::addNode(char * nodeName, char nodeType, menuCallback functPtr)
+{
+    this->tree->addNode(nodeName, nodeType, functPtr);
+}
+
+void menuFrame::manAddNode(char * nodeName, menuIndex menuNum, char nodeType, menuCallback functPtr)
+{
+    this->tree->manAddNode(nodeName, menuNum, nodeType, functPtr);
+}
+
+void menuFrame::linkNode(menuIndex menuNum)
+{
+    this->tree->linkNode(menuNum);
+}
+
+void menuFrame::addNode(const char * nodeName, menuHandler handler, unsigned char context)
+{
+    this->tree->addNode(nodeName, handler, context);
+}
+
+void menuFrame::addValue(const char * nodeName, menuValue * value)
+{
+    this->tree->addValue(nodeName, value);
+}
+
+void menuFrame::setLanguage(menuLanguage table)
+{
+    this->tree->setLanguage(table);
+}
+
+void menuFrame::setIcons(menuIconTable table)
+{
+    this->tree->setIcons(table);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::delNode:
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       January 16, 2023
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::delNode(menuIndex menu, menuIndex node)
+{
+    this->tree->menuList[menu].delNode(node);
+
+    // Keep the cursor on a node that still exists
+    this->fitCursor();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::fitCursor: Pulls the cursor back inside the current menu if nodes were removed from under it. Since the
+| tree can be changed through any frame that shares it, this is checked before every build. An edit in progress is
+| dropped if the node now under the cursor has no value to edit.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::fitCursor()
+{
+    this->place(this->nodeIndex);
+
+    if(this->editing && this->tree->menuList[currentMenu].node[nodeIndex].nodeType != NUM_NODE)
+    {
+        this->editing = 0;
+        this->valueDirty = 0;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::place: Selects a node of the current menu and works out the window from it. The node is clamped to the
+| menu, and the window start is clamped so the node is on screen, moving it as little as it can and never leaving
+| empty rows below the last node. Every cursor movement goes through here, so each one is a single clamp.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex node: the node to select
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::place(menuIndex node)
+{
+    menuIndex count = this->tree->menuList[currentMenu].nodeCount;
+
+    if(node >= count)
+    {
+        node = count ? count - 1 : 0;
+    }
+
+    // Lowest and highest window starts that still show the node, the highest also keeping the window full
+    menuIndex lowest = node >= MAX_ITEMS ? node - (MAX_ITEMS - 1) : 0;
+    menuIndex highest = count <= MAX_ITEMS ? 0 : count - MAX_ITEMS < node ? count - MAX_ITEMS : node;
+    menuIndex start = this->menuStartIndex;
+
+    start = start > highest ? highest : start < lowest ? lowest : start;
+
+    this->nodeIndex = node;
+    this->menuStartIndex = start;
+    this->arrowIndex = node - start;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::enter: Switches the frame to another menu, at the node and window it was on when the frame last left it.
+| The position in the menu being left is remembered the same way.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex menuNum: the menu to show
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::enter(menuIndex menuNum)
+{
+    this->savedNode[currentMenu] = this->nodeIndex;
+    this->savedStart[currentMenu] = this->menuStartIndex;
+
+    this->currentMenu = menuNum;
+    this->menuStartIndex = this->savedStart[menuNum];
+    this->place(this->savedNode[menuNum]);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::pageUp: Moves the selection up by a whole window, stopping at the first node
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Does nothing while a value is being edited
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::pageUp()
+{
+    this->noteInput();
+
+    if(!this->editing)
+    {
+        this->place(this->nodeIndex > MAX_ITEMS ? this->nodeIndex - MAX_ITEMS : 0);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::pageDown: Moves the selection down by a whole window, stopping at the last node
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Does nothing while a value is being edited
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::pageDown()
+{
+    this->noteInput();
+
+    if(!this->editing)
+    {
+        menuIndex count = this->tree->menuList[currentMenu].nodeCount;
+
+        this->place(count - this->nodeIndex > MAX_ITEMS ? this->nodeIndex + MAX_ITEMS : count);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::toEnd: Selects the last node of the menu
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Does nothing while a value is being edited
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::toEnd()
+{
+    this->noteInput();
+
+    if(!this->editing)
+    {
+        this->place(this->tree->menuList[currentMenu].nodeCount);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::up: Decrements the node index (decrementing moves it up the menu) 
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Same as newUp, kept for older sketches
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       December 14,2022
+| Edited:     October 19, 2026
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::up()
+{
+    this->newUp();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::down: Increments the node index (incrementing moves it down the menu) 
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Same as newDown, kept for older sketches
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       December 14,2022
+| Edited:     October 19, 2026
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::down()
+{
+    this->newDown();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::choose: Triggers the action associated with the current menu node. This action can be to open another
+| menu, to trigger a linked function via function pointer, or to start or commit the edit of a NUM node's value.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       December 14, 2022
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuFrame::choose()
+{
+    this->noteInput();
+
+    // Depending on if the node triggers another menu, or a function:
+    switch(this->tree->menuList[currentMenu].node[nodeIndex].nodeType)
+    {
+        // Changes the current menu index and resets the node index to start at the top of the new menu
+        case SUB_NODE:
+        // Remember the menu the frame came from so back() can return to it
+        if(this->depth < MAX_DEPTH)
+        {
+            this->history[depth] = this->currentMenu;
+            this->depth++;
+        }
+
+        // Open the node's linked menu where this frame last left it
+        this->enter(this->tree->menuList[currentMenu].node[nodeIndex].target);
+        break;
+
+        // Triggers the function pointer associated with the menu node
+        case ACT_NODE:
+        // Activate the linked function for the node, timed against the action budget
+        return this->tree->runAction(this->currentMenu, this->nodeIndex);
+
+        // Starts editing the value, or commits it if it was already being edited
+        case NUM_NODE:
+        {
+            menuValue * value = this->selectedValue();
+
+            if(!this->editing)
+            {
+                this->editValue = value->value;
+                this->editing = 1;
+                this->valueDirty = 0;
+                value->format(this->editValue, this->editText);
+            }
+
+            else
+            {
+                this->editing = 0;
+                value->value = this->editValue;
+
+                if(value->commit)
+                {
+                    return value->commit(this->editValue);
+                }
+            }
+        }
+
+        break;
+    }
+
+    return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::back: Returns to the previous menu if there is one. Also resets the node index to the node that triggered
+| the current menu. The frame's own history is used first, so frames sharing a tree each go back along their own path.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       December 14, 2022
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::back()
+{
+    this->noteInput();
+
+    // Going back while editing a value throws the edit away and stays on the node
+    if(this->editing)
+    {
+        this->editing = 0;
+        this->valueDirty = 0;
+        return;
+    }
+
+    // Return exactly to where this frame came from, which enter() remembered when it left
+    if(this->depth)
+    {
+        this->depth--;
+        this->enter(this->history[depth]);
+        return;
+    }
+
+    // Otherwise follow the menu's back link and select the node that opens it
+    menuIndex parentNode = this->tree->menuList[currentMenu].backLink[NODE];
+
+    this->enter(this->tree->menuList[currentMenu].backLink[MENU]);
+    this->place(parentNode);
+}
+
+void menuFrame::newUp()
+{
+    this->noteInput();
+
+    // While a value is being edited, up and down step the value instead of moving the cursor
+    if(this->editStep(1))
+    {
+        return;
+    }
+
+    if(this->nodeIndex)
+    {
+        this->place(this->nodeIndex - 1);
+    }
+}
+
+
+
+
+void menuFrame::newDown()
+{
+    this->noteInput();
+
+    // While a value is being edited, up and down step the value instead of moving the cursor
+    if(this->editStep(-1))
+    {
+        return;
+    }
+
+    this->place(this->nodeIndex + 1);
+}
+
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::newBuild: Composes the current menu into the display buffer and starts sending it to the display. The
+| buffer is locked while a previous frame is still being sent, in which case nothing is composed. Nothing is composed
+| or sent either if the frame would be identical to the last one sent (see frameHash).
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - update() must be called from the main loop for the frame to reach the display
+| - Edits waiting in the frame's queue are made first, even when nothing is drawn
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       January 16, 2023
+| Edited:     October 19, 2026
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::newBuild()
+{
+    // Edits made from interrupts or other tasks go in before anything is read from the tree
+    if(this->queue)
+    {
+        this->queue->apply(this->tree);
+    }
+
+    // Don't draw over a frame that is still being sent, the last one would tear. Nothing is drawn while blanked
+    if(this->display.busy() || this->idleState == IDLE_BLANK)
+    {
+        return;
+    }
+
+    // The tree may have been changed by another frame since the last build
+    this->fitCursor();
+
+    // If only the edited value has changed since a frame showing the edit was drawn, redraw just the digits that changed
+    if(this->valueDirty && this->editShown)
+    {
+        this->drawValue();
+        return;
+    }
+
+    // Start the label from the beginning whenever a different node is selected
+    this->marqueeFollow();
+
+    // Skip the whole frame if it would look the same as the one already on the display
+    unsigned long hash = this->frameHash();
+
+    if(hash == this->lastHash)
+    {
+        this->skipCount++;
+
+        // The display already shows the result of any waiting input
+        if(this->inputPending && !this->inputFlushing)
+        {
+            this->recordLatency(this->inputTime);
+            this->inputPending = 0;
+        }
+
+        return;
+    }
+
+    this->lastHash = hash;
+    this->frameCount++;
+    this->editShown = this->editing;
+
+    // Waiting input is shown by this frame once it has been sent
+    if(this->inputPending)
+    {
+        this->shownTime = this->inputTime;
+        this->inputPending = 0;
+        this->inputFlushing = 1;
+    }
+
+    // Clear the display and draw the menu name across the top
+    this->display.clear();
+    char label[MAX_CHAR];
+    this->display.title(this->tree->menuName(currentMenu, label));
+
+    // For every node
+    for(int i = 0; i < MAX_ITEMS; i++)
+    {   
+        // If the row has a node (nodeCount marks the end of the menu)
+        if(i + this->menuStartIndex < this->tree->menuList[this->currentMenu].nodeCount)
+        {
+            // Draw the row, with an indicator if it is the currently selected node. Only the selected label scrolls
+            const menuNode * node = &this->tree->menuList[this->currentMenu].node[i+this->menuStartIndex];
+
+            const char * name = this->tree->nodeName(this->currentMenu, i + this->menuStartIndex, label);
+
+            this->display.row(i, i == arrowIndex ? 1 + this->editing : 0, name, i == arrowIndex ? this->marqueeShift() : 0,
+                              this->tree->nodeIcon(this->currentMenu, i + this->menuStartIndex),
+                              node->nodeType == NUM_NODE);
+
+            // Show the value of NUM nodes at the end of the row, or the value being edited
+            if(node->nodeType == NUM_NODE)
+            {
+                char text[VALUE_CHARS + 1];
+                menuValue * value = this->tree->values[node->target];
+
+                value->format(i == arrowIndex && this->editing ? this->editValue : value->value, text);
+                this->display.digits(i, text, NULL);
+
+                // Keep what was drawn for the edited value so the next step only redraws changed digits
+                if(i == arrowIndex && this->editing)
+                {
+                    memcpy(this->editText, text, sizeof(text));
+                    this->editDrawn = this->editValue;
+                    this->valueDirty = 0;
+                }
+            }
+        }
+    }
+
+    // Start sending the display buffer, update() finishes the transfer
+    this->display.flush();
+    this->flushing = 1;
+
+    // Displays that don't send in the background are already done
+    if(!this->display.busy())
+    {
+        this->finishFlush();
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::update: Gives the display a chance to send the next part of a frame. Should be called every pass of the
+| main loop; each call only holds the bus for one short transmission.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if the flush is still in progress, 0 once the frame has been fully sent
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Each call still blocks while its transmission is on the bus: Wire sends synchronously, and the transfer is not
+|   driven by an interrupt or DMA. On the SSD1306 that is up to FLUSH_CHUNK bytes, about 0.45 ms at 400 kHz; the loop
+|   is only free between calls. tools/menu_bus.cpp measures it
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuFrame::update()
+{
+    this->idle();
+
+    // Only move the scrolling label once the display is free, so the row isn't changed while it is being sent
+    if(!this->display.busy() && this->idleState == IDLE_AWAKE)
+    {
+        this->marquee();
+    }
+
+    char busy = this->display.update();
+
+    if(this->flushing && !busy)
+    {
+        this->finishFlush();
+    }
+
+    return busy;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::marquee: Scrolls the selected label one character along if it is too wide for its row and its step time
+| has passed. Only the selected row is redrawn and sent, the rest of the frame is left alone.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Called from update(); the selection is picked up by newBuild
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::marquee()
+{
+    unsigned char shift = this->marqueeShift();
+
+    if(!this->marqueeStep())
+    {
+        return;
+    }
+
+    // Whether the display showed the whole view before the step. If something else has changed, it still needs a
+    // full frame from newBuild
+    char current = this->frameHash(shift, this->editValue) == this->lastHash;
+
+    // Redraw just the selected row, and note that the display now shows the scrolled label
+    char label[MAX_CHAR];
+    this->display.row(this->arrowIndex, 1, this->tree->nodeName(marqueeMenu, marqueeNode, label), this->marqueeOffset,
+                      this->tree->nodeIcon(marqueeMenu, marqueeNode),
+                      this->tree->menuList[marqueeMenu].node[marqueeNode].nodeType == NUM_NODE);
+    this->display.flushRow(this->arrowIndex);
+
+    if(current)
+    {
+        this->lastHash = this->frameHash();
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::marqueeStep: Moves the scrolling label one step along once its step time has passed, without drawing
+| anything. The label rests for MARQUEE_HOLD steps at each end before starting over.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if the label is now drawn from a different character, otherwise 0
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuFrame::marqueeStep()
+{
+    const menuNode * selected = &this->tree->menuList[marqueeMenu].node[marqueeNode];
+
+    // Wait for the next build if the selection has moved since the last one
+    if(this->marqueeMenu != this->currentMenu || this->marqueeNode != this->nodeIndex)
+    {
+        return 0;
+    }
+
+    // Nothing to do if the label fits beside the node's icon
+    unsigned char room = this->tree->labelChars(marqueeMenu, marqueeNode);
+
+    if(selected->width <= room * CHAR_WIDTH || millis() - this->marqueeTime < MARQUEE_STEP_MS)
+    {
+        return 0;
+    }
+
+    this->marqueeTime = millis();
+
+    // Last offset that still fills the row, plus the steps spent resting at the end
+    unsigned char last = selected->width / CHAR_WIDTH - room;
+
+    if(this->marqueeOffset < last + MARQUEE_HOLD)
+    {
+        this->marqueeOffset++;
+    }
+
+    else
+    {
+        this->marqueeOffset = 0;
+    }
+
+    // Nothing changes on screen while resting at the end
+    return this->marqueeOffset <= last;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::marqueeFollow: Starts the label from the beginning whenever a different node is selected
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::marqueeFollow()
+{
+    if(this->marqueeMenu != this->currentMenu || this->marqueeNode != this->nodeIndex)
+    {
+        this->marqueeMenu = this->currentMenu;
+        this->marqueeNode = this->nodeIndex;
+        this->marqueeOffset = 0;
+        this->marqueeTime = millis();
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::marqueeShift: Gives the number of characters the selected label is currently scrolled by, holding at the
+| last offset while the label rests at its end
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the character offset to draw the selected label from
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+unsigned char menuFrame::marqueeShift()
+{
+    const menuNode * selected = &this->tree->menuList[marqueeMenu].node[marqueeNode];
+    unsigned char room = this->tree->labelChars(marqueeMenu, marqueeNode);
+
+    if(selected->width <= room * CHAR_WIDTH)
+    {
+        return 0;
+    }
+
+    unsigned char last = selected->width / CHAR_WIDTH - room;
+
+    return this->marqueeOffset < last ? this->marqueeOffset : last;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::frameHash: Works out a signature of what the frame would show: the menu, window position, arrow,
+| scroll offset and the text of the title and every visible row. Two frames with the same signature look the same,
+| so the second one doesn't need to be drawn or sent. Uses 32 bit FNV-1a, which is a multiply and xor per byte.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned char shift: the scroll offset of the selected label, marqueeShift() if not given
+|
+| - long edited: the value being edited, editValue if not given
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the signature of the current view, or of the view as it would be with that offset and edited value
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Anything else that ends up on screen has to be added here too or it won't trigger a redraw
+| - The offset and edited value can be given so a single row redraw can check the rest of the view was already shown
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+unsigned long menuFrame::frameHash()
+{
+    return this->frameHash(this->marqueeShift(), this->editValue);
+}
+
+unsigned long menuFrame::frameHash(unsigned char shift, long edited)
+{
+    menu * shown = &this->tree->menuList[currentMenu];
+    unsigned long hash = 2166136261UL;
+
+    // Mix in the view position, every byte of the indices so menus and nodes past 255 count too
+    menuIndex view[5] = {currentMenu, menuStartIndex, arrowIndex, shift, (menuIndex) editing};
+    unsigned char * bytes = (unsigned char *) view;
+
+    for(unsigned char i = 0; i < sizeof(view); i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619UL;
+    }
+
+    // Mix in the title and the visible labels, with their terminators so moved text still changes the signature
+    char label[MAX_CHAR];
+
+    for(char * c = this->tree->menuName(currentMenu, label); ; c++)
+    {
+        hash = (hash ^ (unsigned char) *c) * 16777619UL;
+
+        if(!*c)
+        {
+            break;
+        }
+    }
+
+    for(int i = 0; i < MAX_ITEMS && i + this->menuStartIndex < shown->nodeCount; i++)
+    {
+        const menuNode * node = &shown->node[i + this->menuStartIndex];
+
+        for(const char * c = this->tree->nodeName(currentMenu, i + this->menuStartIndex, label); ; c++)
+        {
+            hash = (hash ^ (unsigned char) *c) * 16777619UL;
+
+            if(!*c)
+            {
+                break;
+            }
+        }
+
+        // Live values are part of the view too
+        if(node->nodeType == NUM_NODE)
+        {
+            unsigned long number = i == arrowIndex && this->editing ? edited : this->tree->values[node->target]->value;
+
+            for(unsigned char b = 0; b < sizeof(number); b++)
+            {
+                hash = (hash ^ (unsigned char) (number >> (8 * b))) * 16777619UL;
+            }
+        }
+
+        // And where the row's icon is in flash, so changing the icon or the icon table redraws the row
+        menuIcon icon = this->tree->nodeIcon(currentMenu, i + this->menuStartIndex);
+
+        for(unsigned char b = 0; icon && b < sizeof(icon); b++)
+        {
+            hash = (hash ^ (unsigned char) ((size_t) icon >> (8 * b))) * 16777619UL;
+        }
     }
 
-    //Otherwise, the arrow and item will appear at the top of the screen
-    else
+    return hash;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::idle: Dims and then blanks the display once there has been no input for dimTimeout and blankTimeout.
+| Once blanked, nothing is composed or sent until the next input. Called from update().
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::idle()
+{
+    // Let a frame finish sending before changing the display state
+    if(this->idleState == IDLE_BLANK || this->display.busy())
     {
-        this->menuStartIndex = this->menuList[currentMenu].backLink[NODE];
-        this->nodeIndex = this->menuList[currentMenu].backLink[NODE];
-        this->arrowIndex = 0;
+        return;
     }
 
-    //Changes the current node to the one linked in the current menu class
-    this->currentMenu = this->menuList[currentMenu].backLink[MENU];
+    unsigned long idleTime = millis() - this->lastInput;
 
+    if(this->blankTimeout && idleTime >= this->blankTimeout)
+    {
+        this->display.sleep(1);
+        this->idleState = IDLE_BLANK;
+        this->blankCount++;
+    }
+
+    else if(this->idleState == IDLE_AWAKE && this->dimTimeout && idleTime >= this->dimTimeout)
+    {
+        this->display.dim(1);
+        this->idleState = IDLE_DIM;
+        this->dimCount++;
+    }
 }
 
-void menuFrame::newUp()
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::wake: Brings the display back to full brightness after it was dimmed or blanked. A blanked frame is
+| forced to redraw on the next newBuild, and the time until that frame is sent is kept in wakeWorst.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Navigation calls this on their own; call it directly to wake on other events
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::wake()
 {
-    // If the arrow is not at the end, and the index still falls in the accepted range
-    if(this->arrowIndex > 0)
+    this->lastInput = millis();
+
+    if(this->idleState == IDLE_AWAKE)
     {
-        this->arrowIndex--;
-        this->nodeIndex--;
+        return;
     }
 
-    else if(this->arrowIndex == 0 && this->menuStartIndex > 0)
+    if(this->idleState == IDLE_BLANK)
     {
-        this->menuStartIndex--;
-        this->nodeIndex--;
+        this->display.sleep(0);
+
+        // The panel kept what it showed while asleep, so only the build is forced, nothing is resent
+        this->lastHash = 0;
+        this->wakeTime = micros();
+        this->waking = 1;
     }
 
-    Serial.print("\nNode Index: ");
-    Serial.println(this->nodeIndex, DEC);
+    this->display.dim(0);
+    this->idleState = IDLE_AWAKE;
+    this->wakeCount++;
+}
 
-    Serial.print("Arrow Index: ");
-    Serial.println(this->arrowIndex, DEC);
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::stampInput: Marks that an input happened at the given time. Navigation functions do this themselves with
+| the time they are called; call this first to use an earlier time, like the button edge caught in an interrupt.
+| Only the oldest input not yet on screen is kept, since that is the one the user has waited longest for.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned long time: the time of the input in microseconds (from micros())
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::stampInput(unsigned long time)
+{
+    if(!this->inputPending)
+    {
+        this->inputTime = time;
+        this->inputPending = 1;
+    }
+}
 
-    Serial.print("Start #: ");
-    Serial.println(this->menuStartIndex, DEC);
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::noteInput: Stamps an input with the current time, unless one is already waiting to be shown. Also resets
+| the idle timer and wakes the display if it was dimmed or blanked.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::noteInput()
+{
+    this->stampInput(micros());
+    this->wake();
 }
 
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::finishFlush: Called once a frame built by newBuild has been fully sent. Records the latency of the input
+| that frame shows, if there was one.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::finishFlush()
+{
+    this->flushing = 0;
+
+    // The screen is fully back after a wake
+    if(this->waking)
+    {
+        unsigned long time = micros() - this->wakeTime;
 
+        if(time > this->wakeWorst)
+        {
+            this->wakeWorst = time;
+        }
 
+        this->waking = 0;
+    }
 
-void menuFrame::newDown()
-{
-    // If the arrow is not at the end, and the index still falls in the accepted range
-    if(this->arrowIndex < MAX_ITEMS-1 && this->arrowIndex + this->menuStartIndex < this->menuList[currentMenu].nodeCount-1)
+    if(this->inputFlushing)
     {
-        this->arrowIndex++;
-        this->nodeIndex++;
+        this->recordLatency(this->shownTime);
+        this->inputFlushing = 0;
     }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::recordLatency: Adds the time from an input to now to the latency histogram
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - unsigned long start: the time of the input in microseconds
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::recordLatency(unsigned long start)
+{
+    unsigned long latency = micros() - start;
+    unsigned long ms = latency / 1000;
+    unsigned char bin = 0;
 
-    else if(this->arrowIndex == MAX_ITEMS-1 && this->menuStartIndex + MAX_ITEMS-1 < this->menuList[currentMenu].nodeCount-1)
+    // Bin by the power of two of the latency in milliseconds
+    while(ms && bin < LATENCY_BINS - 1)
     {
-        this->menuStartIndex++;
-        this->nodeIndex++;
+        ms >>= 1;
+        bin++;
     }
 
-    Serial.print("\nNode Index: ");
-    Serial.println(this->nodeIndex, DEC);
+    if(this->latencyHist[bin] < 0xFFFF)
+    {
+        this->latencyHist[bin]++;
+    }
 
-    Serial.print("Arrow Index: ");
-    Serial.println(this->arrowIndex, DEC);
+    if(latency > this->latencyWorst)
+    {
+        this->latencyWorst = latency;
+    }
 
-    Serial.print("Start #: ");
-    Serial.println(this->menuStartIndex, DEC);
+    this->latencyCount++;
 }
 
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::printLatency: Prints the input-to-display latency histogram, one bin per line as "<upper ms> <count>",
+| followed by the worst case and the number of inputs measured
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - Print * out: where to print the report, usually &Serial
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::printLatency(Print * out)
+{
+    out->println("latency_ms count");
+
+    for(unsigned char i = 0; i < LATENCY_BINS; i++)
+    {
+        out->print(i < LATENCY_BINS - 1 ? "<" : ">=");
+        out->print(1UL << (i < LATENCY_BINS - 1 ? i : i - 1));
+        out->print(" ");
+        out->println((unsigned long) this->latencyHist[i]);
+    }
 
+    out->print("worst_us ");
+    out->println(this->latencyWorst);
+    out->print("inputs ");
+    out->println(this->latencyCount);
+}
 
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::selectedValue: Gives the value of the selected node
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: the value the selected node edits, only meaningful if it is a NUM node
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+menuValue * menuFrame::selectedValue()
+{
+    return this->tree->values[this->tree->menuList[currentMenu].node[nodeIndex].target];
+}
 
-void menuFrame::newBuild()
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::editStep: Steps the value being edited up or down, if one is being edited
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - char direction: 1 to step up, -1 to step down
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if a value is being edited (and the input was used for it), otherwise 0
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuFrame::editStep(char direction)
 {
-        // Clear the display
-    oledDisplay.clearDisplay();
-    oledDisplay.setTextColor(WHITE); // Draw white text
-    oledDisplay.setCursor(0, 0);     // Start at top-left corner
+    if(!this->editing)
+    {
+        return 0;
+    }
 
-    // Use larger text font for menu name
-    oledDisplay.setTextSize(2);      // Normal 1:1 pixel scale
-    // Menu title front decorator
-    oledDisplay.write(" ");
-    // Display menu name
-    oledDisplay.write(this->menuList[currentMenu].name);
-    // Menu title back decorator and newline
-    oledDisplay.write("\n");
+    long stepped = this->selectedValue()->adjust(this->editValue, direction);
 
-    // Set text to smallest size for menu nodes
-    oledDisplay.setTextSize(1);      // Normal 1:1 pixel scale
+    if(stepped != this->editValue)
+    {
+        this->editValue = stepped;
+        this->valueDirty = 1;
+    }
 
+    return 1;
+}
 
-    //---------------------------------------------------------------------
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::drawValue: Redraws the value being edited by only touching the characters that changed since it was last
+| drawn, and sends just that row. Used by newBuild in place of a full frame while a value is swept up or down.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::drawValue()
+{
+    char text[VALUE_CHARS + 1];
 
-    // For every node
-    for(int i = 0; i < MAX_ITEMS; i++)
-    {   
-        // If the menu is configured (nodeType is not 0)
-        if(this->menuList[this->currentMenu].node[i+this->menuStartIndex].nodeType)
-        {
-        
-            // If on the currently selected node, display a special indicator
-            if(i == arrowIndex)
-            {
-                oledDisplay.write(">");
-            }
+    // Whether the display showed the whole view apart from the new value
+    char current = this->frameHash(this->marqueeShift(), this->editDrawn) == this->lastHash;
 
-            // Otherwise space out the same amount of characters to keep nodes aligned
-            else
-            {
-                oledDisplay.write(" ");
+    this->selectedValue()->format(this->editValue, text);
+    this->display.digits(this->arrowIndex, text, this->editText);
+    this->display.flushRow(this->arrowIndex);
 
-            }
-            
-            // Display menu name to OLED
-            oledDisplay.write(this->menuList[this->currentMenu].node[i+this->menuStartIndex].name);
-            oledDisplay.write("\n");
-        }
+    memcpy(this->editText, text, sizeof(text));
+    this->editDrawn = this->editValue;
+    this->valueDirty = 0;
+
+    // The frame on screen now matches the view, later builds can be skipped. Otherwise the next build draws the rest
+    if(current)
+    {
+        this->lastHash = this->frameHash();
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::jump: Moves the frame straight to a node of any menu. The history is cleared, so back() follows the
+| menu's back link from there.
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - menuIndex menuNum: the menu to show
+|
+| - menuIndex nodeNum: the node to select in it
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if the frame moved, 0 if the menu or node doesn't exist
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuFrame::jump(menuIndex menuNum, menuIndex nodeNum)
+{
+    if(menuNum >= MAX_MENUS || nodeNum >= this->tree->menuList[menuNum].nodeCount)
+    {
+        return 0;
     }
 
-    // Send display buffer
-    //oledDisplay.display();
+    this->noteInput();
+
+    this->editing = 0;
+    this->valueDirty = 0;
+    this->depth = 0;
+
+    this->enter(menuNum);
+    this->place(nodeNum);
+
+    return 1;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::redraw: Forces the next newBuild to draw and send the frame even if nothing has changed, for example
+| after the display was powered back up or drawn over by something else
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: nothing
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+void menuFrame::redraw()
+{
+    this->lastHash = 0;
+    this->display.invalidate();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+| menuFrame::flushDone: Tells if the last frame has finished being sent to the display
+|        -------------------------------------------------------------------------------------------------------
+| Arguments:
+| - N/A
+|        -------------------------------------------------------------------------------------------------------
+| Returns: 1 if no flush is in progress, otherwise 0
+|
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+----------------------------------------------------------------------------------------------------------------------*/
+char menuFrame::flushDone()
+{
+    return !this->display.busy();
 }
 
 // -------------------------------------------------------------------------------------------------------------------- //
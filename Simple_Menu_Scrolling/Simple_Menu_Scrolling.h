@@ -28,16 +28,167 @@
 // ------------------------- /_____/  /____/  /_/      /___/  /_/  \_/  /____/  /_____/ ------------------------------- //
 // -------------------------------------------------------------------------------------------------------------------- //
 
+#ifndef MAX_CHAR
 #define MAX_CHAR        16
+#endif
+#ifndef MAX_NODES
 #define MAX_NODES       30
+#endif
+
+// Nodes per page of paged node storage, 0 to give every menu a fixed array of MAX_NODES nodes. With pages, menus take
+// them from a pool of MENU_PAGES as they grow and give them back as they shrink, so large MAX_NODES only costs the
+// nodes actually used (plus 2 bytes a menu for every NODE_PAGE nodes it could hold)
+#ifndef NODE_PAGE
+#define NODE_PAGE       0
+#endif
+#ifndef MENU_PAGES
+#define MENU_PAGES      (2 * MAX_MENUS)
+#endif
+#ifndef MAX_ITEMS
 #define MAX_ITEMS       6
+#endif
+#ifndef MAX_MENUS
 #define MAX_MENUS       10
+#endif
+#ifndef MAX_DEPTH
+#define MAX_DEPTH       8
+#endif
+#ifndef MAX_CALLBACKS
+#define MAX_CALLBACKS   16
+#endif
+#ifndef MAX_VALUES
+#define MAX_VALUES      8
+#endif
+
+// 1 to give every node an icon slot (one byte of RAM a node), drawn in front of its label on displays with pixels
+#ifndef MENU_ICONS
+#define MENU_ICONS      0
+#endif
+
+// Number of input-to-display latency histogram bins. Bin 0 is under 1 ms, bin n is 2^(n-1) up to 2^n ms
+#define LATENCY_BINS    12
+
+// Idle states of a menu frame
+#define IDLE_AWAKE      0
+#define IDLE_DIM        1
+#define IDLE_BLANK      2
+
+// Time between each character step of a scrolling label, and the number of steps it rests at each end
+#define MARQUEE_STEP_MS 300
+#define MARQUEE_HOLD    3
+
+// RAM the menus may use in bytes (one tree, MENU_FRAMES frames and their display buffers). 0 turns the check off
+#ifndef MENU_RAM_BUDGET
+#define MENU_RAM_BUDGET 0
+#endif
+#ifndef MENU_FRAMES
+#define MENU_FRAMES     1
+#endif
+
+// Number of edits a menuQueue holds. A power of two no larger than 128, as the queue counts in bytes
+#ifndef QUEUE_SIZE
+#define QUEUE_SIZE      8
+#endif
+
+// Tree edits a menuQueue can carry
+#define EDIT_NODE_NAME  1
+#define EDIT_MENU_NAME  2
+#define EDIT_DEL_NODE   3
+#define EDIT_ADD_NODE   4
 
 #define SUB_NODE        1
 #define ACT_NODE        2
+#define NUM_NODE        3
+
+// Marker drawn in front of a row: not selected, selected, selected and being edited
+#define ROW_MARKS       " >*"
+
+// Characters used to show the value of a NUM node, right aligned at the end of its row
+#define VALUE_CHARS     7
+
+// Status codes returned when building menus in bulk
+#define MENU_OK         0
+#define MENU_ERR_INDEX  1
+#define MENU_ERR_NODES  2
+#define MENU_ERR_LINK   3
+#define MENU_ERR_NAME   4
+#define MENU_ERR_CALLS  5
+#define MENU_ERR_TYPE   6
+#define MENU_ERR_VALUES 7
+#define MENU_ERR_UNREACHED 8
+
+// Node flag set when an ACT node's slot holds a handler that takes the node and its context
+#define NODE_HANDLER    0x01
+
+// Node flag set when the label is a string ID looked up in the tree's language table instead of text held in RAM
+#define NODE_TEXT       0x02
+
+// Bits available for a node's target (the linked menu of a SUB node or callback slot of an ACT node)
+#define TARGET_BITS     10
 
 #define MENU            0
 #define NODE            1
+#define START           2
+
+// An icon in flash, one row tall: its width in columns, then its columns (one byte each, least significant bit at the
+// top) run-length coded in packets. A packet header with the top bit set repeats the next byte (header & 0x7F) times,
+// otherwise (header) bytes follow as they are. tools/menu_icon.py makes them from ASCII art, e.g.
+//   const unsigned char ICON_GEAR[] PROGMEM = {8, 0x08, 0x18, 0x7E, ...};
+typedef const unsigned char * menuIcon;
+
+/*  ---------------------------------------------------------------------------------------------------------------------/
+|  ------------------------------------------------- ICON READER CLASS -------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuIconReader: Unpacks a run-length coded icon (see menuIcon) one column at a time, straight out of flash, so a
+| display can write each column into its row as it comes without the icon ever being unpacked into RAM. Defined ahead
+| of the display backends, which draw the icons.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Columns past the icon's width read as blank, so the caller decides how many columns to draw
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuIconReader
+{
+  public:
+
+  // The next byte to read, the columns of the icon still to come, and what is left of the current packet
+  const unsigned char * at;
+  unsigned char left;
+  unsigned char count = 0;
+  unsigned char value = 0;
+  char repeat = 0;
+
+  menuIconReader(menuIcon icon);
+
+  unsigned char next();
+};
+
+// Display backends. Set MENU_DISPLAY to the one in use; its Menu_Display_*.h header is included below
+#define DISPLAY_SSD1306 1
+#define DISPLAY_LCD     2
+#define DISPLAY_SERIAL  3
+#define DISPLAY_BUFFER  4
+
+#ifndef MENU_DISPLAY
+#define MENU_DISPLAY    DISPLAY_SSD1306
+#endif
+
+#if MENU_DISPLAY == DISPLAY_SSD1306
+#include "Menu_Display_SSD1306.h"
+#elif MENU_DISPLAY == DISPLAY_LCD
+#include "Menu_Display_LCD.h"
+#elif MENU_DISPLAY == DISPLAY_SERIAL
+#include "Menu_Display_Serial.h"
+#elif MENU_DISPLAY == DISPLAY_BUFFER
+#include "Menu_Display_Buffer.h"
+#else
+#error "MENU_DISPLAY must be set to one of the DISPLAY_ backends"
+#endif
 
 
 
@@ -48,25 +199,169 @@
 // -------------------------------------------------------------------------------------------------------------------- //
 
 
+// The smallest index type that can hold every node and menu number for the configured sizes
+#if MAX_NODES < 256 && MAX_MENUS < 256
+typedef unsigned char menuIndex;
+#else
+typedef unsigned short menuIndex;
+#endif
+
+// Returned instead of a callback or value slot when the table is full. Never a real slot
+#define NO_SLOT         ((menuIndex) -1)
+
+// Used for printing reports, defined by the Arduino core
+class Print;
+
+// The function an ACT node triggers
+typedef char (*menuCallback)(void);
+
+// A function shared by a family of ACT nodes. It is told which node triggered it and that node's context value, so
+// one handler can serve e.g. a whole list of channels without a separate function for each
+typedef char (*menuHandler)(menuIndex menuNum, menuIndex nodeNum, unsigned char context);
+
+// One entry of the callback table: a plain function or a handler, tagged with which one it holds so neither has to be
+// cast to the other's type
+struct menuAction
+{
+  union
+  {
+    menuCallback call;
+    menuHandler handler;
+  };
+
+  // Set if handler is the one held
+  char isHandler;
+
+  menuAction() : call(NULL), isHandler(0) {}
+  menuAction(menuCallback call) : call(call), isHandler(0) {}
+  menuAction(menuHandler handler) : handler(handler), isHandler(1) {}
+
+  // Set if there is no function to call
+  bool empty() const
+  {
+    return isHandler ? !handler : !call;
+  }
+
+  bool operator==(const menuAction & other) const
+  {
+    return isHandler == other.isHandler && (isHandler ? handler == other.handler : call == other.call);
+  }
+};
+
+// The function a NUM node calls when a new value is committed
+typedef char (*menuCommit)(long value);
+
+// Called when an action runs longer than its budget, with the node that triggered it and the time it took (us)
+typedef void (*menuOverrun)(menuIndex menuNum, menuIndex nodeNum, unsigned long time);
+
+// Adds one byte to a CRC-16/CCITT (polynomial 0x1021). Start from 0xFFFF. Used by the remote protocol and the stored
+// records
+unsigned short menuCrcStep(unsigned short crc, unsigned char byte);
+
+class menuValue;
+
+// A language: a table in flash of pointers to the strings in flash, indexed by string ID. Every language used by a
+// tree lists its strings in the same order, e.g.
+//   const char START_EN[] PROGMEM = "Start";
+//   const char * const ENGLISH[] PROGMEM = {START_EN, ...};
+typedef const char * const * menuLanguage;
+
+// The icons nodes can use: a table in flash of pointers to icons in flash. A node's icon slot holds its index plus
+// one, 0 for no icon, e.g.
+//   const menuIcon ICONS[] PROGMEM = {ICON_GEAR, ICON_PLAY};
+typedef const menuIcon * menuIconTable;
+
+// One node of a menu declared up front: its name, SUB_NODE, ACT_NODE or NUM_NODE, the menu a SUB node opens, the
+// function an ACT node triggers and the value a NUM node edits. An ACT node can give a handler and context instead
+// of a plain function. A NULL name takes the label from the language table with string ID text
+struct menuNodeDef
+{
+  const char * name;
+  char type;
+  menuIndex link;
+  menuCallback action;
+  menuValue * value;
+  menuHandler handler;
+  unsigned char context;
+  unsigned short text;
+
+  // Icon slot of the node, 0 for none
+  unsigned char icon;
+
+  // The entry the node takes in the callback table
+  menuAction slot() const
+  {
+    return handler ? menuAction(handler) : menuAction(action);
+  }
+};
+
+// A whole menu declared up front, for building with menuTree::buildMenu or buildTree. A NULL name takes the title from
+// the language table with string ID text
+struct menuDef
+{
+  const char * name;
+  const menuNodeDef * nodes;
+  menuIndex nodeCount;
+  unsigned short text;
+};
+
 // -------------------------------------------------------------------------------------------------------------------- //
 // --------------------------- / ___/  / /     /  \      / ____/  / ____/  / ___/  / ____/ ---------------------------- //
 // -------------------------- / /__   / /__   / /_\\     \__ \    \__ \   / __/    \__ \  ----------------------------- //
 // ------------------------- /____/  /____/  /_/   \\  /_____/  /_____/  /____/  /_____/ ------------------------------ //
 // -------------------------------------------------------------------------------------------------------------------- //
 
+/*  ---------------------------------------------------------------------------------------------------------------------/ 
+|  -------------------------------------------------- VALUE CLASS ------------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuValue: A number edited in place by a NUM node. The value is a fixed point integer: with 2 decimals, 1234 is shown
+| as 12.34. The object belongs to the program and is only pointed to by the tree, so the program can read and change
+| the value directly and the menu shows it live.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}  
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuValue
+{
+  public:
+
+  // The current value and the range and step it is edited in
+  long value;
+  long min;
+  long max;
+  long step;
+
+  // Number of digits after the decimal point
+  unsigned char decimals;
+
+  // Called with the new value when an edit is committed, may be NULL
+  menuCommit commit;
+
+  long adjust(long number, char direction);
+  void format(long number, char * out);
+};
+
 /*  ---------------------------------------------------------------------------------------------------------------------/ 
 |  -------------------------------------------------- NODE CLASS -------------------------------------------------------/
 | ---------------------------------------------------------------------------------------------------------------------/
 | menuNode: A class for representing each option (node) within a menu. The class stores information such as
-| the type of node, it's name, the index of a menu it might link to, and a function pointer. An ACT node triggers a function, while a SUB node links to
-| another menu.
+| the type of node, it's name, and the index of the menu or callback it links to. An ACT node triggers a function, while a SUB node links to
+| another menu. Type, flags and target are packed into one 16 bit field. The name is still held in the node, so on AVR
+| each node costs MAX_CHAR bytes plus four (five with MENU_ICONS): a node labelled from the language table only uses two of
+| the MAX_CHAR for its string ID. tools/menu_footprint.cpp prints the breakdown.
 |        -------------------------------------------------------------------------------------------------------
 | Notes/Future Changes:
 | - 
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
 | Date:       December 14, 2022
-| Edited:     {Date}  
+| Edited:     October 19, 2026
 |-----------------------------------------------------------------------------------------------------------------------/
 |----------------------------------------------------------------------------------------------------------------------/
 |--------------------------------------------------------------------------------------------------------------------*/
@@ -74,26 +369,167 @@ class menuNode
 {
   public:
 
-  // Name of the node
-  char name[MAX_CHAR];
+  // Name of the node, or the string ID of its label when NODE_TEXT is set
+  union
+  {
+    char name[MAX_CHAR];
+    unsigned short text;
+  };
 
   // Tells if a node triggers an action or opens another menu. 0 if unconfigured
-  char nodeType = 0;
+  unsigned short nodeType : 2;
+
+  // Spare bits for node options
+  unsigned short flags : 16 - 2 - TARGET_BITS;
+
+  // The menu a SUB node opens, or the slot in the tree's callback or value table an ACT or NUM node uses
+  unsigned short target : TARGET_BITS;
+
+  // Width of the name on the display, worked out when the name is set so it is never measured while drawing
+  unsigned char width;
 
-  // Stores the menu that the node might call if it is configured as a submenu node
-  char menuCall = 0;
+  // Passed to the handler of an ACT node that has one, to tell nodes sharing the handler apart
+  unsigned char context;
 
-  // The function pointer for the node if is configured as an action node
-  char (*choose)(void);
+#if MENU_ICONS
+  // Index plus one of the node's icon in the tree's icon table, 0 for none
+  unsigned char icon = 0;
+#endif
 
-  void config(char * namePtr, char type, char (*functPtr) (void));
+  menuNode() : nodeType(0), flags(0), target(0), width(0), context(0) {}
+
+  void config(const char * namePtr, char type, menuIndex call);
   void del();
-  void setName(char * namePtr);
-  void link(char menuNum);
+  void setName(const char * namePtr);
+  void link(menuIndex menuNum);
   
 
 };
 
+#if NODE_PAGE
+
+// Page slots each menu has, and the slot value of a page not taken yet
+#define PAGE_SLOTS      ((MAX_NODES + NODE_PAGE - 1) / NODE_PAGE)
+#define NO_PAGE         0xFFFF
+
+// NODE_PAGE nodes that follow each other in a menu
+struct menuPage
+{
+  menuNode node[NODE_PAGE];
+};
+
+/*  ---------------------------------------------------------------------------------------------------------------------/
+|  ------------------------------------------------- NODE PAGES CLASS --------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuNodes: The nodes of a menu, held in pages from a pool shared by every menu. Node n is in the page of slot
+| n / NODE_PAGE, so finding a node is one lookup however big the tree is.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Nodes in a page not taken yet read as unconfigured (nodeType 0), so the end of a menu can still be found by
+|   reading past it. They can't be written; reserve() the pages first
+| - Pages go back to the pool when the menu is destroyed. Copying a menu copies its nodes into pages of its own,
+|   moving one (e.g. tree = menuTree()) hands its pages over
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuNodes
+{
+  public:
+
+  // The pool page holding each run of NODE_PAGE nodes, NO_PAGE where the menu doesn't reach yet
+  unsigned short page[PAGE_SLOTS];
+
+  menuNodes();
+  menuNodes(const menuNodes & other);
+  menuNodes(menuNodes && other);
+  ~menuNodes();
+
+  menuNodes & operator=(const menuNodes & other);
+  menuNodes & operator=(menuNodes && other);
+
+  // Reads a node. Nodes past the last page read as the unconfigured EMPTY
+  const menuNode & operator[](menuIndex nodeNum) const
+  {
+    unsigned short at = nodeNum < MAX_NODES ? this->page[nodeNum / NODE_PAGE] : NO_PAGE;
+
+    return at == NO_PAGE ? EMPTY : pool[at].node[nodeNum % NODE_PAGE];
+  }
+
+  // Gives a node to write. Its page must have been reserved; writes to nodes past the last page go to a scratch node
+  // that is never read
+  menuNode & edit(menuIndex nodeNum)
+  {
+    unsigned short at = nodeNum < MAX_NODES ? this->page[nodeNum / NODE_PAGE] : NO_PAGE;
+
+    return at == NO_PAGE ? scratch : pool[at].node[nodeNum % NODE_PAGE];
+  }
+
+  char reserve(menuIndex count);
+  void release(menuIndex count);
+  unsigned short needs(menuIndex count);
+
+  // The pool, the pages given back to it and the number of pages never handed out yet
+  static menuPage pool[MENU_PAGES];
+  static unsigned short freed[MENU_PAGES];
+  static unsigned short freedCount;
+  static unsigned short usedCount;
+
+  // What nodes past the last page read as, and where writes to them go
+  static const menuNode EMPTY;
+  static menuNode scratch;
+
+  static unsigned short spare();
+};
+
+#define POOL_RAM        (MENU_PAGES * (sizeof(menuPage) + sizeof(unsigned short)))
+
+static_assert(MENU_PAGES < NO_PAGE, "MENU_PAGES must be below 65535");
+
+#else
+
+// The nodes of a menu, all MAX_NODES of them held in the menu. Has the same calls as the paged version
+class menuNodes
+{
+  public:
+
+  menuNode node[MAX_NODES];
+
+  const menuNode & operator[](menuIndex nodeNum) const
+  {
+    return this->node[nodeNum];
+  }
+
+  menuNode & edit(menuIndex nodeNum)
+  {
+    return this->node[nodeNum];
+  }
+
+  char reserve(menuIndex count)
+  {
+    return count <= MAX_NODES;
+  }
+
+  void release(menuIndex) {}
+
+  unsigned short needs(menuIndex)
+  {
+    return 0;
+  }
+
+  static unsigned short spare()
+  {
+    return 0;
+  }
+};
+
+#define POOL_RAM        0
+
+#endif
+
 
 /*  ---------------------------------------------------------------------------------------------------------------------/ 
 |  -------------------------------------------------- NODE CLASS -------------------------------------------------------/
@@ -114,21 +550,28 @@ class menu
 {
   public:
 
-  // The name of the menu
-  char name[MAX_CHAR];
+  // The name of the menu, or the string ID of its title when localized is set
+  union
+  {
+    char name[MAX_CHAR];
+    unsigned short text;
+  };
 
-  // Array of node objects to populate menu
-  menuNode node[MAX_NODES];
+  char localized = 0;
+
+  // The nodes of the menu, in a fixed array or in pages (see NODE_PAGE)
+  menuNodes node;
   
   // Keeps track of how many nodes are configured
-  char nodeCount = 0;
+  menuIndex nodeCount = 0;
 
-  // Stores the parent node that links to the menu for when the "go back" action is called
-  char backLink[2];
+  // Stores the parent node that links to the menu for when the "go back" action is called. A menu nothing links to
+  // goes back to the first node of menu 0
+  menuIndex backLink[2] = {0, 0};
 
-void addNode(char * nodeName, char nodeType, char (*functPtr) (void));
-void setName(char * namePtr);
-void delNode(char node);
+void addNode(char * nodeName, char nodeType, menuIndex call);
+void setName(const char * namePtr);
+void delNode(menuIndex node);
 void resetNodes();
 
 };
@@ -136,66 +579,432 @@ void resetNodes();
 /*  ---------------------------------------------------------------------------------------------------------------------/ 
 |  -------------------------------------------------- NODE CLASS -------------------------------------------------------/
 | ---------------------------------------------------------------------------------------------------------------------/
-| menuFrame: The menu frame holds all of the menus and keeps track of user input and current menu/node. It also
-| keeps track of the currently configured menu and node to make building a menu easier and more user friendly. This
-| class is responsible for displaying the current state of the menus and triggering changes based on user input
+| menuTree: The menu tree holds all of the menus. It also keeps track of the currently configured menu and node to
+| make building a menu easier and more user friendly. The tree has no cursor of its own; menu frames browse it.
 |        -------------------------------------------------------------------------------------------------------
 | Notes/Future Changes:
 | - 
 |        -------------------------------------------------------------------------------------------------------
 | Created by: Cameron Jupp
 | Date:       December 14, 2022
-| Edited:     {Date}  
+| Edited:     October 19, 2026
 |-----------------------------------------------------------------------------------------------------------------------/
 |----------------------------------------------------------------------------------------------------------------------/
 |--------------------------------------------------------------------------------------------------------------------*/
-// Holds all of the menus and keeps track of user input and indexing
-// also builds/displays the menus
-class menuFrame
+// Holds all of the menus and the state used while building them. Shared by any number of menu frames
+class menuTree
 {
   public:
 
   // Array to hold all of the menus
   menu menuList[MAX_MENUS];
 
-  // Keeps track of the up/down position on the menu
-  char nodeIndex = 0;
-  
-  // Keeps track of the current menu
-  char currentMenu = 0;
+  // Every function used by an ACT node, stored once no matter how many nodes use it. Plain functions and handlers
+  // share the table, each entry tagged with which it is (nodes using a handler also have NODE_HANDLER set)
+  menuAction callbacks[MAX_CALLBACKS];
+
+  // Number of callback slots in use
+  menuIndex callbackCount = 0;
+
+  menuTree();
+
+  // Run time statistics for each callback slot: number of calls, total and worst time (us), and the node that
+  // triggered the worst run
+  unsigned short callCount[MAX_CALLBACKS];
+  unsigned long callTotal[MAX_CALLBACKS];
+  unsigned long callWorst[MAX_CALLBACKS];
+  menuIndex worstNode[MAX_CALLBACKS][2];
+
+  // Longest an action may run (us) before overrun is called. 0 turns the check off
+  unsigned long actionBudget = 0;
+  menuOverrun overrun = NULL;
+
+  // Number of actions that went over budget
+  unsigned long overrunCount = 0;
+
+  // The values edited by NUM nodes
+  menuValue * values[MAX_VALUES];
+
+  // Number of value slots in use
+  menuIndex valueCount = 0;
+
+  // The language table labels given as string IDs are looked up in, NULL until one is set
+  menuLanguage language = NULL;
+
+  // The table node icon slots are looked up in, NULL until one is set
+  menuIconTable icons = NULL;
+
+  // The menu and node validate() found a problem at
+  menuIndex errorAt[2];
+
+  // The MENU_ERR_ code of the first node left out because a table was full, and the menu and node it would have been.
+  // validate() reports it
+  char refused = MENU_OK;
+  menuIndex refusedAt[2];
 
   // During configuration, keeps track of the most recently created menu
-  char configIndex = 0;
+  menuIndex configIndex = 0;
 
   // During configuration, keeps track of the node most recently created for linking purposes
-  char nodeLinkIndex = 0;
+  menuIndex nodeLinkIndex = 0;
+
+  void addMenu (char * menuName, menuIndex index);
+  void addNode(char * nodeName, char nodeType, menuCallback functPtr);
+  void manAddNode(char * nodeName, menuIndex menuNum, char nodeType, menuCallback functPtr);
+  void linkNode(menuIndex menuNum);
+  void addNode(const char * nodeName, menuHandler handler, unsigned char context);
+  menuIndex addCallback(menuCallback functPtr);
+  menuIndex addHandler(menuHandler handler);
+  menuIndex addAction(menuAction action);
+  void refuse(char status, menuIndex menuNum);
+  char runAction(menuIndex menuNum, menuIndex nodeNum);
+  void printActions(Print * out);
+  void addValue(const char * nodeName, menuValue * value);
+  menuIndex addValueSlot(menuValue * value);
+
+  void setLanguage(menuLanguage table);
+  void nameText(unsigned short text);
+  void titleText(unsigned short text);
+  unsigned char textWidth(unsigned short text);
+  char * lookup(unsigned short text, char * buffer);
+  const char * nodeName(menuIndex menuNum, menuIndex nodeNum, char * buffer);
+  char * menuName(menuIndex menuNum, char * buffer);
+
+  void setIcons(menuIconTable table);
+  void setIcon(unsigned char icon);
+  menuIcon nodeIcon(menuIndex menuNum, menuIndex nodeNum);
+  unsigned char labelChars(menuIndex menuNum, menuIndex nodeNum);
+
+  char buildMenu(menuIndex index, const menuDef * def);
+  char buildTree(const menuDef * defs, menuIndex menuCount);
+  char checkMenu(const menuDef * def, menuIndex menuLimit);
+  menuIndex newCallbacks(const menuDef * defs, menuIndex menuCount);
+  menuIndex newValues(const menuDef * defs, menuIndex menuCount);
+  void writeMenu(menuIndex index, const menuDef * def);
+  char validate();
+
+};
+
+// One change to a tree waiting in a menuQueue: an EDIT_ code, where it applies and what it needs
+struct menuEdit
+{
+  unsigned char code;
+  menuIndex menuNum;
+  menuIndex nodeNum;
+  char nodeType;
+  menuCallback action;
+  char name[MAX_CHAR];
+};
+
+/*  ---------------------------------------------------------------------------------------------------------------------/
+|  -------------------------------------------------- QUEUE CLASS ------------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuQueue: Carries changes to a tree from an interrupt or another task to the frame that draws it. The tree is
+| never touched by the producer; the frame whose queue it is applies every waiting edit at the start of its next
+| newBuild, so a frame is never drawn from a half made change.
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - Lock free for one producer and one consumer. Producers sharing a queue have to take turns themselves
+| - A full queue drops the edit and counts it in dropped rather than making the producer wait
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       October 19, 2026
+| Edited:     {Date}
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+class menuQueue
+{
+  public:
+
+  menuEdit edits[QUEUE_SIZE];
+
+  // Number of edits ever added and ever applied. Only the producer moves head and only the consumer moves tail, so
+  // each side writes one byte the other reads
+  volatile unsigned char head = 0;
+  volatile unsigned char tail = 0;
 
-  char menuStartIndex = 0;
+  // Number of edits dropped because the queue was full, only changed by the producer
+  unsigned long dropped = 0;
+
+  char setName(menuIndex menuNum, menuIndex nodeNum, const char * nodeName);
+  char setTitle(menuIndex menuNum, const char * menuName);
+  char delNode(menuIndex menuNum, menuIndex nodeNum);
+  char addNode(const char * nodeName, menuIndex menuNum, char nodeType, menuCallback functPtr);
+
+  menuEdit * reserve(unsigned char code, menuIndex menuNum, menuIndex nodeNum);
+  void publish();
+  unsigned char apply(menuTree * tree);
+};
+
+static_assert(QUEUE_SIZE && QUEUE_SIZE <= 128 && !(QUEUE_SIZE & (QUEUE_SIZE - 1)), "QUEUE_SIZE must be a power of two up to 128");
+
+/*  ---------------------------------------------------------------------------------------------------------------------/ 
+|  -------------------------------------------------- NODE CLASS -------------------------------------------------------/
+| ---------------------------------------------------------------------------------------------------------------------/
+| menuFrame: A viewer over a menu tree. The frame keeps track of user input, the current menu/node, the path taken to
+| get there and the display it draws on. Several frames can browse the same tree independently, each only costing its
+| cursor state and display. This class is responsible for displaying the current state of the menus and triggering
+| changes based on user input
+|        -------------------------------------------------------------------------------------------------------
+| Notes/Future Changes:
+| - 
+|        -------------------------------------------------------------------------------------------------------
+| Created by: Cameron Jupp
+| Date:       December 14, 2022
+| Edited:     October 19, 2026
+|-----------------------------------------------------------------------------------------------------------------------/
+|----------------------------------------------------------------------------------------------------------------------/
+|--------------------------------------------------------------------------------------------------------------------*/
+// Keeps track of user input and indexing within a shared menu tree
+// also builds/displays the menus
+class menuFrame
+{
+  public:
 
-  char arrowIndex = 0;
+  // The menus being browsed, may be shared with other frames
+  menuTree * tree;
 
-  void addMenu (char * menuName, char index);
-  void addNode(char * nodeName, char nodeType, char (*functPtr) (void));
-  void manAddNode(char * nodeName, char menuNum, char nodeType, char (*functPtr) (void));
-  void delNode(char menu, char node);
-  void linkNode(char menuNum);
+  // Keeps track of the up/down position on the menu
+  menuIndex nodeIndex = 0;
+  
+  // Keeps track of the current menu
+  menuIndex currentMenu = 0;
+
+  // The first node in the window and the row the selected node is on, both worked out from nodeIndex by place()
+  menuIndex menuStartIndex = 0;
+
+  menuIndex arrowIndex = 0;
+
+  // Each menu entered to get to the current one, for going back
+  menuIndex history[MAX_DEPTH];
+
+  // The node and window start the frame was at in each menu when it last left it
+  menuIndex savedNode[MAX_MENUS];
+  menuIndex savedStart[MAX_MENUS];
+
+  // Number of entries in the history
+  unsigned char depth = 0;
+
+  // The display the frame is drawn on, picked at compile time with MENU_DISPLAY
+  menuDisplay display;
+
+  // Edits to the tree made elsewhere, applied at the start of each newBuild. NULL if the frame has none
+  menuQueue * queue = NULL;
+
+  // The node whose label is scrolling, how many characters it has scrolled and when it last moved
+  menuIndex marqueeMenu = 0;
+  menuIndex marqueeNode = 0;
+  unsigned char marqueeOffset = 0;
+  unsigned long marqueeTime = 0;
+
+  // Signature of the last frame sent, and how many builds were sent or skipped because nothing had changed
+  unsigned long lastHash = 0;
+  unsigned long frameCount = 0;
+  unsigned long skipCount = 0;
+
+  // Time (micros) of the oldest input not drawn yet, and of the oldest input in the frame being sent
+  unsigned long inputTime = 0;
+  unsigned long shownTime = 0;
+  char inputPending = 0;
+  char inputFlushing = 0;
+
+  // Set while a flush started by newBuild is in progress
+  char flushing = 0;
+
+  // Input-to-display latency: histogram, worst case (us) and number of inputs measured
+  unsigned short latencyHist[LATENCY_BINS];
+  unsigned long latencyWorst = 0;
+  unsigned long latencyCount = 0;
+
+  // Time (millis) without input before the display is dimmed and then blanked. 0 turns that step off
+  unsigned long dimTimeout = 0;
+  unsigned long blankTimeout = 0;
+
+  // Time (millis) of the last input, and whether the display is awake, dimmed or blanked
+  unsigned long lastInput = 0;
+  char idleState = IDLE_AWAKE;
+
+  // Idle statistics: times dimmed, blanked and woken, and the worst time (us) from a wake to the first frame sent
+  unsigned long dimCount = 0;
+  unsigned long blankCount = 0;
+  unsigned long wakeCount = 0;
+  unsigned long wakeWorst = 0;
+
+  // Time (micros) of the last wake, and whether the first frame after it is still to be sent
+  unsigned long wakeTime = 0;
+  char waking = 0;
+
+  // Set while the selected NUM node is being edited, with the value being edited and the value and text last drawn for
+  // it
+  char editing = 0;
+  long editValue = 0;
+  long editDrawn = 0;
+  char editText[VALUE_CHARS + 1];
+
+  // Set when the edited value has changed but not been drawn yet, and when the last full frame showed the edit
+  char valueDirty = 0;
+  char editShown = 0;
+
+  menuFrame(menuTree * treePtr);
+
+  void addMenu (char * menuName, menuIndex index);
+  void addNode(char * nodeName, char nodeType, menuCallback functPtr);
+  void manAddNode(char * nodeName, menuIndex menuNum, char nodeType, menuCallback functPtr);
+  void delNode(menuIndex menu, menuIndex node);
+  void linkNode(menuIndex menuNum);
+  void fitCursor();
+  void place(menuIndex node);
+  void enter(menuIndex menuNum);
 
   void newUp();
   void newDown();
+  void pageUp();
+  void pageDown();
+  void toEnd();
   void newBuild();
 
+  char update();
+  char flushDone();
+  void marquee();
+  char marqueeStep();
+  void marqueeFollow();
+  unsigned char marqueeShift();
+  unsigned long frameHash();
+  unsigned long frameHash(unsigned char shift, long edited);
+  void redraw();
+
+  void stampInput(unsigned long time);
+  void noteInput();
+  void finishFlush();
+  void recordLatency(unsigned long start);
+  void printLatency(Print * out);
+
+  void idle();
+  void wake();
+
+  void addNode(const char * nodeName, menuHandler handler, unsigned char context);
+  void addValue(const char * nodeName, menuValue * value);
+  void setLanguage(menuLanguage table);
+  void setIcons(menuIconTable table);
+  menuValue * selectedValue();
+  char editStep(char direction);
+  void drawValue();
+
   void up();
   void down();
   char choose();
   void back();
+  char jump(menuIndex menuNum, menuIndex nodeNum);
 
 };
 
+// -------------------------------------------------------------------------------------------------------------------- //
+// ---------------------------------------------- MEMORY BUDGET ------------------------------------------------------- //
+// -------------------------------------------------------------------------------------------------------------------- //
+
+// Total RAM used by the menus. DISPLAY_RAM is memory the display driver holds outside of the frame (e.g. the SSD1306
+// frame buffer the Adafruit library allocates at startup), and POOL_RAM the node page pool
+#define MENU_RAM        (sizeof(menuTree) + POOL_RAM + MENU_FRAMES * (sizeof(menuFrame) + DISPLAY_RAM))
+
+static_assert(MAX_ITEMS <= MAX_NODES, "MAX_ITEMS can't be larger than MAX_NODES");
+static_assert(MAX_MENUS < (1 << TARGET_BITS) && MAX_CALLBACKS < (1 << TARGET_BITS), "Node targets are TARGET_BITS wide, raise it or lower MAX_MENUS/MAX_CALLBACKS");
+static_assert(MAX_CALLBACKS < NO_SLOT && MAX_VALUES < NO_SLOT, "MAX_CALLBACKS and MAX_VALUES must fit below NO_SLOT");
+static_assert(MAX_CHAR * CHAR_WIDTH <= 255, "A node's name width must fit its unsigned char width field, lower MAX_CHAR");
+
+#if MENU_RAM_BUDGET
+static_assert(MENU_RAM <= MENU_RAM_BUDGET, "The menus don't fit in MENU_RAM_BUDGET. Lower MAX_MENUS, MAX_NODES or MAX_CHAR");
+#endif
+
 // -------------------------------------------------------------------------------------------------------------------- //
 // -------------------  / ___/  / / //  / \  / /  / ___/ /__  __/  /_  _/  / __  /  / \  / /  / ____/ ----------------- //
 // ------------------  / __/   / /_//  / /\\/ /  / /__     / /      / /   / /_/ /  / /\\/ /   \__ \ ------------------- //
 // -----------------  /_/     /____/  /_/  \_/  /____/    /_/     /___/  /_____/  /_/  \_/  /_____/ ------------------- //
 // -------------------------------------------------------------------------------------------------------------------- //
 
+// Compile time checks of menus declared up front. The menuDef array and the node arrays it points to have to be
+// constexpr. menuCheck gives the same MENU_ERR_ codes as buildTree, and also MENU_ERR_UNREACHED for a menu that no
+// SUB node path from menu 0 leads to. MENU_STATIC_CHECK turns each of them into a compile error, e.g.
+//   constexpr menuDef MENUS[] = {...};
+//   MENU_STATIC_CHECK(MENUS);
+
+// Length of a name, 0 for a NULL name (a label from the language table)
+constexpr unsigned char menuNameLength(const char * name)
+{
+  return name && *name ? 1 + menuNameLength(name + 1) : 0;
+}
+
+// Checks one node: its name, type, value and that a SUB node opens a menu that exists and has nodes
+constexpr char menuCheckNode(const menuDef * defs, menuIndex count, const menuNodeDef * node)
+{
+  return menuNameLength(node->name) >= MAX_CHAR ? MENU_ERR_NAME :
+         node->type != SUB_NODE && node->type != ACT_NODE && node->type != NUM_NODE ? MENU_ERR_TYPE :
+         node->type == NUM_NODE && !node->value ? MENU_ERR_VALUES :
+         node->type == SUB_NODE && (node->link >= count || !defs[node->link].nodeCount) ? MENU_ERR_LINK :
+         MENU_OK;
+}
+
+// Checks the nodes of a menu from node onwards, giving the first problem
+constexpr char menuCheckNodes(const menuDef * defs, menuIndex count, menuIndex menuNum, menuIndex node)
+{
+  return node >= defs[menuNum].nodeCount ? MENU_OK :
+         menuCheckNode(defs, count, &defs[menuNum].nodes[node]) != MENU_OK ?
+         menuCheckNode(defs, count, &defs[menuNum].nodes[node]) :
+         menuCheckNodes(defs, count, menuNum, node + 1);
+}
+
+// Tells if a node of menu parent from node onwards opens menu target
+constexpr bool menuLinksTo(const menuDef * defs, menuIndex parent, menuIndex node, menuIndex target)
+{
+  return node < defs[parent].nodeCount &&
+         ((defs[parent].nodes[node].type == SUB_NODE && defs[parent].nodes[node].link == target) ||
+          menuLinksTo(defs, parent, node + 1, target));
+}
+
+constexpr bool menuReached(const menuDef * defs, menuIndex count, menuIndex target, menuIndex depth);
+
+// Tells if a menu from parent onwards opens target and can itself be reached within depth steps
+constexpr bool menuReachedFrom(const menuDef * defs, menuIndex count, menuIndex target, menuIndex parent,
+                               menuIndex depth)
+{
+  return parent < count &&
+         ((menuLinksTo(defs, parent, 0, target) && menuReached(defs, count, parent, depth - 1)) ||
+          menuReachedFrom(defs, count, target, parent + 1, depth));
+}
+
+// Tells if menu 0 leads to target in at most depth steps
+constexpr bool menuReached(const menuDef * defs, menuIndex count, menuIndex target, menuIndex depth)
+{
+  return target == 0 || (depth && menuReachedFrom(defs, count, target, 0, depth));
+}
+
+// Checks the menus from menuNum onwards, giving the first problem
+constexpr char menuCheckMenus(const menuDef * defs, menuIndex count, menuIndex menuNum)
+{
+  return menuNum >= count ? MENU_OK :
+         defs[menuNum].nodeCount > MAX_NODES ? MENU_ERR_NODES :
+         menuNameLength(defs[menuNum].name) >= MAX_CHAR ? MENU_ERR_NAME :
+         menuCheckNodes(defs, count, menuNum, 0) != MENU_OK ? menuCheckNodes(defs, count, menuNum, 0) :
+         !menuReached(defs, count, menuNum, count) ? MENU_ERR_UNREACHED :
+         menuCheckMenus(defs, count, menuNum + 1);
+}
+
+// Checks a whole declared tree, giving MENU_OK or the first problem found
+constexpr char menuCheck(const menuDef * defs, menuIndex count)
+{
+  return count > MAX_MENUS ? MENU_ERR_INDEX : menuCheckMenus(defs, count, 0);
+}
+
+#define MENU_COUNT(defs) ((menuIndex) (sizeof(defs) / sizeof(defs[0])))
+
+#define MENU_STATIC_CHECK(defs) \
+  static_assert(menuCheck(defs, MENU_COUNT(defs)) != MENU_ERR_INDEX, #defs " has more menus than MAX_MENUS"); \
+  static_assert(menuCheck(defs, MENU_COUNT(defs)) != MENU_ERR_NODES, #defs " has a menu with more than MAX_NODES nodes"); \
+  static_assert(menuCheck(defs, MENU_COUNT(defs)) != MENU_ERR_NAME, #defs " has a name of MAX_CHAR or more characters"); \
+  static_assert(menuCheck(defs, MENU_COUNT(defs)) != MENU_ERR_TYPE, #defs " has a node of unknown type"); \
+  static_assert(menuCheck(defs, MENU_COUNT(defs)) != MENU_ERR_VALUES, #defs " has a NUM node without a value"); \
+  static_assert(menuCheck(defs, MENU_COUNT(defs)) != MENU_ERR_LINK, #defs " has a SUB node opening a missing or empty menu"); \
+  static_assert(menuCheck(defs, MENU_COUNT(defs)) != MENU_ERR_UNREACHED, #defs " has a menu no SUB node leads to")
+
 
 #endif
\ No newline at end of file
@@ -0,0 +1,168 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Arduino.h: The few parts of the Arduino core the scrolling menu library uses, for building host tools with the text
+| buffer or SSD1306 display backend. Put this directory on the include path (-Itools/host). Time comes from the host
+| clock, or is simulated (see hostSimulated), and anything printed to Serial is thrown away; other Print objects can be
+| pointed at a file.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#define DEC             10
+#define HEX             16
+
+// Flash is ordinary memory on the host
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *) (p))
+#define pgm_read_word(p) (*(const uint16_t *) (p))
+#define pgm_read_ptr(p)  (*(void * const *) (p))
+#define strncpy_P       strncpy
+#define strlen_P        strlen
+
+// Time normally comes from the host clock. A tool that wants the same numbers on every run sets hostSimulated, and
+// then time only moves when something waits: the tool itself, or the mock bus for the bytes it sends
+static bool hostSimulated = false;
+static unsigned long hostTime = 0;
+
+static inline unsigned long micros()
+{
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  if(hostSimulated)
+  {
+    return hostTime;
+  }
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+static inline unsigned long millis()
+{
+  return micros() / 1000;
+}
+
+// Holds the caller for us microseconds, spinning on the host clock so the time is spent as it would be on the board
+static inline void delayMicroseconds(unsigned long us)
+{
+  if(hostSimulated)
+  {
+    hostTime += us;
+    return;
+  }
+
+  unsigned long start = micros();
+
+  while(micros() - start < us)
+  {
+  }
+}
+
+static inline void delay(unsigned long ms)
+{
+  delayMicroseconds(ms * 1000);
+}
+
+static inline void noInterrupts() {}
+static inline void interrupts() {}
+
+// Writes to a file, or nowhere if it has none
+class Print
+{
+  public:
+
+  FILE * file = NULL;
+
+  virtual size_t write(uint8_t c)
+  {
+    return file ? fputc(c, file) != EOF : 1;
+  }
+
+  size_t write(const uint8_t * buffer, size_t size)
+  {
+    size_t written = 0;
+
+    while(size--)
+    {
+      written += write(*buffer++);
+    }
+
+    return written;
+  }
+
+  size_t write(const char * s)
+  {
+    return write((const uint8_t *) s, strlen(s));
+  }
+
+  size_t print(const char * s)
+  {
+    return file ? fputs(s, file) : 0;
+  }
+
+  size_t print(char c)
+  {
+    return write(c);
+  }
+
+  size_t print(unsigned long n, int base = DEC)
+  {
+    return file ? fprintf(file, base == HEX ? "%lx" : "%lu", n) : 0;
+  }
+
+  size_t print(long n, int base = DEC)
+  {
+    return file ? fprintf(file, base == HEX ? "%lx" : "%ld", n) : 0;
+  }
+
+  size_t print(unsigned n, int base = DEC)
+  {
+    return print((unsigned long) n, base);
+  }
+
+  size_t print(int n, int base = DEC)
+  {
+    return print((long) n, base);
+  }
+
+  size_t println()
+  {
+    return print("\n");
+  }
+
+  template <typename T> size_t println(T value)
+  {
+    return print(value) + println();
+  }
+
+  template <typename T> size_t println(T value, int base)
+  {
+    return print(value, base) + println();
+  }
+};
+
+class Stream : public Print
+{
+  public:
+
+  virtual int available()
+  {
+    return 0;
+  }
+
+  virtual int read()
+  {
+    return -1;
+  }
+};
+
+static Stream Serial;
+
+#endif
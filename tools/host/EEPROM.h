@@ -0,0 +1,74 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| EEPROM.h: The Arduino EEPROM library for host tools, kept in a file so what is saved lasts from one run to the next.
+| Point EEPROM.file at a file opened for reading and writing ("r+b", or "w+b" to start erased). With no file every
+| byte reads as erased (0xFF) and writes are thrown away.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+#include "Arduino.h"
+
+// Size of the EEPROM on an ATmega328P
+#define HOST_EEPROM_SIZE 1024
+
+class EEPROMClass
+{
+  public:
+
+  FILE * file = NULL;
+
+  // Number of bytes written, as a stand-in for wear
+  unsigned long writes = 0;
+
+  uint8_t read(int address)
+  {
+    if(!file || fseek(file, address, SEEK_SET))
+    {
+      return 0xFF;
+    }
+
+    int c = fgetc(file);
+
+    return c == EOF ? 0xFF : c;
+  }
+
+  void write(int address, uint8_t value)
+  {
+    // Bytes between the end of the file and the address read as erased
+    if(!file || fseek(file, 0, SEEK_END))
+    {
+      return;
+    }
+
+    for(long end = ftell(file); end < address; end++)
+    {
+      fputc(0xFF, file);
+    }
+
+    fseek(file, address, SEEK_SET);
+    fputc(value, file);
+    fflush(file);
+    writes++;
+  }
+
+  void update(int address, uint8_t value)
+  {
+    if(read(address) != value)
+    {
+      write(address, value);
+    }
+  }
+
+  uint16_t length()
+  {
+    return HOST_EEPROM_SIZE;
+  }
+};
+
+static EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,357 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| OLED_Tools.h: A 128x64 SSD1306 panel and the parts of its Adafruit driver the SSD1306 display backend uses, for
+| building host tools with MENU_DISPLAY set to DISPLAY_SSD1306. Put this directory on the include path (-Itools/host).
+|
+| The driver draws into its frame buffer the way Adafruit GFX does with the classic font. The panel is separate: it
+| only changes when commands and data are sent to it over Wire, so oledPanel.ram holds what the screen would show,
+| including anything the library forgot to send.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef HOST_OLED_TOOLS_H
+#define HOST_OLED_TOOLS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <glcdfont.c>
+
+#define BLACK               0
+#define WHITE               1
+#define SSD1306_BLACK       0
+#define SSD1306_WHITE       1
+
+#define SSD1306_SETCONTRAST 0x81
+#define SSD1306_DISPLAYOFF  0xAE
+#define SSD1306_DISPLAYON   0xAF
+#define SSD1306_COLUMNADDR  0x21
+#define SSD1306_PAGEADDR    0x22
+
+#define PANEL_ADDRESS       0x3C
+#define PANEL_WIDTH         128
+#define PANEL_HEIGHT        64
+#define PANEL_BYTES         (PANEL_WIDTH * PANEL_HEIGHT / 8)
+
+// The display RAM of the controller, written through the column and page address window set by the last commands,
+// one page byte at a time in horizontal addressing mode
+class hostPanel
+{
+  public:
+
+  uint8_t ram[PANEL_BYTES];
+
+  // Address window and where the next data byte goes
+  uint8_t columnStart = 0;
+  uint8_t columnEnd = PANEL_WIDTH - 1;
+  uint8_t pageStart = 0;
+  uint8_t pageEnd = PANEL_HEIGHT / 8 - 1;
+  uint8_t column = 0;
+  uint8_t page = 0;
+
+  char on = 1;
+  uint8_t contrast = 0xCF;
+
+  // A command still waiting for arguments. Like the controller, arguments may come in later transmissions, as they do
+  // when the driver sends a byte at a time with ssd1306_command
+  uint8_t command = 0;
+  uint8_t argumentsNeeded = 0;
+  uint8_t argumentCount = 0;
+  uint8_t arguments[2];
+
+  hostPanel()
+  {
+    memset(ram, 0, sizeof(ram));
+  }
+
+  // Takes one transmission: a control byte of 0x00 for commands or 0x40 for data, then the bytes. Commands other than
+  // the ones the library sends are taken to have no arguments
+  void receive(const uint8_t * data, size_t length)
+  {
+    if(!length)
+    {
+      return;
+    }
+
+    if(data[0] == 0x40)
+    {
+      for(size_t i = 1; i < length; i++)
+      {
+        ram[page * PANEL_WIDTH + column] = data[i];
+
+        if(column < columnEnd)
+        {
+          column++;
+        }
+
+        else
+        {
+          column = columnStart;
+          page = page < pageEnd ? page + 1 : pageStart;
+        }
+      }
+
+      return;
+    }
+
+    for(size_t i = 1; i < length; i++)
+    {
+      if(argumentCount < argumentsNeeded)
+      {
+        arguments[argumentCount++] = data[i];
+
+        if(argumentCount == argumentsNeeded)
+        {
+          run();
+        }
+
+        continue;
+      }
+
+      command = data[i];
+      argumentCount = 0;
+      argumentsNeeded = 0;
+
+      switch(command)
+      {
+        case SSD1306_COLUMNADDR:
+        case SSD1306_PAGEADDR: argumentsNeeded = 2; break;
+        case SSD1306_SETCONTRAST: argumentsNeeded = 1; break;
+        case SSD1306_DISPLAYOFF: on = 0; break;
+        case SSD1306_DISPLAYON: on = 1; break;
+      }
+    }
+  }
+
+  // Carries out command once its arguments are in
+  void run()
+  {
+    switch(command)
+    {
+      case SSD1306_COLUMNADDR:
+      column = columnStart = arguments[0] % PANEL_WIDTH;
+      columnEnd = arguments[1] % PANEL_WIDTH;
+      break;
+
+      case SSD1306_PAGEADDR:
+      page = pageStart = arguments[0] % (PANEL_HEIGHT / 8);
+      pageEnd = arguments[1] % (PANEL_HEIGHT / 8);
+      break;
+
+      case SSD1306_SETCONTRAST:
+      contrast = arguments[0];
+      break;
+    }
+  }
+};
+
+static hostPanel oledPanel;
+
+static inline void oledReceive(uint8_t address, const uint8_t * data, size_t length)
+{
+  if(address == PANEL_ADDRESS)
+  {
+    oledPanel.receive(data, length);
+  }
+}
+
+class Adafruit_SSD1306 : public Print
+{
+  public:
+
+  uint8_t pixels[PANEL_BYTES];
+
+  int16_t cursorX = 0;
+  int16_t cursorY = 0;
+  uint8_t textSize = 1;
+  uint16_t textColor = WHITE;
+  bool wrap = true;
+  bool fullCodePage = false;
+
+  // The panel hears everything the driver and the library send on the bus
+  Adafruit_SSD1306()
+  {
+    memset(pixels, 0, sizeof(pixels));
+    Wire.receiver = oledReceive;
+  }
+
+  int16_t width()
+  {
+    return PANEL_WIDTH;
+  }
+
+  int16_t height()
+  {
+    return PANEL_HEIGHT;
+  }
+
+  uint8_t * getBuffer()
+  {
+    return pixels;
+  }
+
+  void clearDisplay()
+  {
+    memset(pixels, 0, sizeof(pixels));
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color)
+  {
+    if(x < 0 || y < 0 || x >= PANEL_WIDTH || y >= PANEL_HEIGHT)
+    {
+      return;
+    }
+
+    if(color)
+    {
+      pixels[y / 8 * PANEL_WIDTH + x] |= 1 << (y & 7);
+    }
+
+    else
+    {
+      pixels[y / 8 * PANEL_WIDTH + x] &= ~(1 << (y & 7));
+    }
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+  {
+    for(int16_t i = 0; i < w; i++)
+    {
+      for(int16_t j = 0; j < h; j++)
+      {
+        drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+
+  void setCursor(int16_t x, int16_t y)
+  {
+    cursorX = x;
+    cursorY = y;
+  }
+
+  void setTextSize(uint8_t size)
+  {
+    textSize = size ? size : 1;
+  }
+
+  // Text is drawn without a background, as with a single colour
+  void setTextColor(uint16_t color)
+  {
+    textColor = color;
+  }
+
+  void setTextWrap(bool on)
+  {
+    wrap = on;
+  }
+
+  void cp437(bool on = true)
+  {
+    fullCodePage = on;
+  }
+
+  // Draws a character with its top left corner at x, y. As in Adafruit GFX, characters 176 and up skip a place in the
+  // font unless cp437 is on
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint8_t size)
+  {
+    if(x >= PANEL_WIDTH || y >= PANEL_HEIGHT || x + 6 * size - 1 < 0 || y + 8 * size - 1 < 0)
+    {
+      return;
+    }
+
+    if(!fullCodePage && c >= 176)
+    {
+      c++;
+    }
+
+    for(int8_t i = 0; i < 5; i++)
+    {
+      uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+
+      for(int8_t j = 0; j < 8; j++, line >>= 1)
+      {
+        if(line & 1)
+        {
+          fillRect(x + i * size, y + j * size, size, size, color);
+        }
+      }
+    }
+  }
+
+  using Print::write;
+
+  size_t write(uint8_t c)
+  {
+    if(c == '\n')
+    {
+      cursorX = 0;
+      cursorY += textSize * 8;
+    }
+
+    else if(c != '\r')
+    {
+      if(wrap && cursorX + textSize * 6 > PANEL_WIDTH)
+      {
+        cursorX = 0;
+        cursorY += textSize * 8;
+      }
+
+      drawChar(cursorX, cursorY, c, textColor, textSize);
+      cursorX += textSize * 6;
+    }
+
+    return 1;
+  }
+
+  void ssd1306_command(uint8_t c)
+  {
+    Wire.beginTransmission(PANEL_ADDRESS);
+    Wire.write((uint8_t) 0x00);
+    Wire.write(c);
+    Wire.endTransmission();
+  }
+
+  // Sends the whole frame buffer, a Wire buffer at a time
+  void display()
+  {
+    Wire.beginTransmission(PANEL_ADDRESS);
+    Wire.write((uint8_t) 0x00);
+    Wire.write((uint8_t) SSD1306_PAGEADDR);
+    Wire.write((uint8_t) 0);
+    Wire.write((uint8_t) (PANEL_HEIGHT / 8 - 1));
+    Wire.write((uint8_t) SSD1306_COLUMNADDR);
+    Wire.write((uint8_t) 0);
+    Wire.write((uint8_t) (PANEL_WIDTH - 1));
+    Wire.endTransmission();
+
+    for(size_t sent = 0; sent < PANEL_BYTES; sent += BUFFER_LENGTH - 1)
+    {
+      size_t count = PANEL_BYTES - sent < BUFFER_LENGTH - 1 ? PANEL_BYTES - sent : BUFFER_LENGTH - 1;
+
+      Wire.beginTransmission(PANEL_ADDRESS);
+      Wire.write((uint8_t) 0x40);
+      Wire.write(pixels + sent, count);
+      Wire.endTransmission();
+    }
+  }
+
+  void dim(bool on)
+  {
+    Wire.beginTransmission(PANEL_ADDRESS);
+    Wire.write((uint8_t) 0x00);
+    Wire.write((uint8_t) SSD1306_SETCONTRAST);
+    Wire.write((uint8_t) (on ? 0 : 0xCF));
+    Wire.endTransmission();
+  }
+};
+
+static Adafruit_SSD1306 oledDisplay;
+
+static inline void oledSystemInit()
+{
+  oledDisplay.clearDisplay();
+  oledDisplay.display();
+}
+
+#endif
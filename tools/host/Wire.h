@@ -0,0 +1,82 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| Wire.h: An I2C bus for building host tools. Nothing is sent anywhere; each finished transmission is handed to
+| receiver instead, which a mock device (see OLED_Tools.h) uses to follow what the library sends it. Like the AVR core,
+| a transmission holds at most BUFFER_LENGTH bytes and the rest are dropped.
+|
+| endTransmission holds the caller for as long as the transmission would take on the bus, like the Arduino Wire
+| libraries do, so a tool can measure what a flush costs the main loop. Each byte, the address included, takes about
+| 10 clock periods: 8 data bits, the acknowledge and the gap before the next byte. That is 25 us at the default of
+| 400 kHz and 100 us at 100 kHz (setClock).
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+
+#define BUFFER_LENGTH   32
+
+class TwoWire : public Print
+{
+  public:
+
+  // Called with the address and bytes of every finished transmission, if set
+  void (*receiver)(uint8_t address, const uint8_t * data, size_t length) = NULL;
+
+  // The transmission being written
+  uint8_t address = 0;
+  uint8_t data[BUFFER_LENGTH];
+  size_t length = 0;
+
+  // Time each byte holds the bus for (us), and the total time spent sending
+  unsigned long byteTime = 25;
+  unsigned long busTime = 0;
+
+  void begin() {}
+
+  void setClock(unsigned long clock)
+  {
+    byteTime = 10000000UL / clock;
+  }
+
+  void beginTransmission(uint8_t address)
+  {
+    this->address = address;
+    length = 0;
+  }
+
+  using Print::write;
+
+  size_t write(uint8_t c)
+  {
+    if(length >= BUFFER_LENGTH)
+    {
+      return 0;
+    }
+
+    data[length++] = c;
+    return 1;
+  }
+
+  uint8_t endTransmission(bool stop = true)
+  {
+    (void) stop;
+
+    if(receiver)
+    {
+      receiver(address, data, length);
+    }
+
+    delayMicroseconds((length + 1) * byteTime);
+    busTime += (length + 1) * byteTime;
+    length = 0;
+    return 0;
+  }
+};
+
+static TwoWire Wire;
+
+#endif
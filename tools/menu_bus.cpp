@@ -0,0 +1,299 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| menu_bus.cpp: Host tool that measures how much of the main loop is left for other work while frames are sent to an
+| SSD1306. The library is built in with the SSD1306 backend, on the mock bus in tools/host/Wire.h, which holds the
+| caller for the time each transmission takes on the wire. Time is simulated, so every run gives the same numbers:
+|
+|   g++ -std=gnu++11 -Itools/host tools/menu_bus.cpp -o menu_bus
+|   ./menu_bus [clock]        (bus clock in Hz, 400000 if left out)
+|
+| The loop is run the way a sketch runs it: each pass may take an input, then calls newBuild and update(), then does
+| LOOP_WORK us of other work. It prints how long a blocking display() of the whole buffer takes, how long newBuild
+| (composing) and update() (flushing) held the loop, and how much of the time a frame was being sent went to other
+| work instead. It exits with 1 if newBuild itself waited on the bus.
+|
+| update() still blocks for each FLUSH_CHUNK transmission, since Wire sends synchronously and the transfer is not
+| driven by an interrupt or DMA; "worst update" is the time one such call holds the loop.
+|
+| Then the input-to-display latency histogram is checked with loops of a few lengths. Inputs come in between passes,
+| as a button caught by an interrupt would, and are stamped with that time. Each reaches the screen before the next
+| comes in, and some of them change nothing on screen. The tool works out the latency of each input itself and
+| exits with 1 unless printLatency reports the same bins, worst case and count.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#define MENU_DISPLAY    1
+#define MAX_CHAR        24
+#define MAX_ITEMS       4
+
+#include "../Simple_Menu_Scrolling/Simple_Menu_Scrolling.cpp"
+#include "../Simple_Menu_Scrolling/Menu_Display_SSD1306.cpp"
+
+#include <stdlib.h>
+#include <string>
+
+// Other work each pass of the loop does (us), the time between inputs (us) and how long the loop is run for (us)
+#define LOOP_WORK       500
+#define INPUT_PERIOD    50000
+#define RUN_TIME        10000000
+
+// The latency sessions: the other work a pass does in each (us). update() sends one chunk a pass, so the longer the
+// pass, the longer a frame takes to reach the screen
+static const unsigned long LATENCY_LOOPS[] = {500, 2000, 8000};
+#define LATENCY_INPUTS  60
+
+// Longest an input may take to be counted before it is taken as lost (us)
+#define LATENCY_LIMIT   5000000
+
+// The inputs, repeated: u(p), d(own), c(hoose) and b(ack). Up at the top of a menu changes nothing on screen
+static const char STEPS[] = "ddddddduuuuuuucdddbdduccuub";
+static const char LATENCY_STEPS[] = "udduuucuuuubdddd";
+
+static char noAction()
+{
+  return 0;
+}
+
+static menuValue level = {50, 0, 100, 5, 0, NULL};
+
+static void buildMenus(menuTree * tree)
+{
+  tree->addMenu((char *) "Main", 0);
+  tree->addNode((char *) "Settings", SUB_NODE, NULL);
+  tree->linkNode(1);
+  tree->addNode((char *) "Start", ACT_NODE, noAction);
+  tree->addValue("Level", &level);
+  tree->addNode((char *) "A label too long to fit", ACT_NODE, noAction);
+  tree->addNode((char *) "Stop", ACT_NODE, noAction);
+  tree->addNode((char *) "Reset", ACT_NODE, noAction);
+  tree->addNode((char *) "About", ACT_NODE, noAction);
+
+  tree->addMenu((char *) "Settings", 1);
+  tree->addNode((char *) "Contrast", ACT_NODE, noAction);
+  tree->addNode((char *) "Sleep", ACT_NODE, noAction);
+  tree->addNode((char *) "Language", ACT_NODE, noAction);
+  tree->addNode((char *) "Units", ACT_NODE, noAction);
+}
+
+static void step(menuFrame * frame, char input)
+{
+  switch(input)
+  {
+    case 'u': frame->newUp(); break;
+    case 'd': frame->newDown(); break;
+    case 'c': frame->choose(); break;
+    case 'b': frame->back(); break;
+  }
+}
+
+// Runs the loop with an input every INPUT_PERIOD and prints where the time went. Returns 1 if newBuild held the bus
+static char overlap(menuTree * tree, unsigned long clock)
+{
+  menuFrame * frame = new menuFrame(tree);
+
+  // What the frame replaces: the driver sending the whole buffer in one go
+  unsigned long start = micros();
+  oledDisplay.display();
+  unsigned long blocking = micros() - start;
+
+  unsigned long composeTime = 0;
+  unsigned long flushTime = 0;
+  unsigned long flushWorst = 0;
+  unsigned long flightTime = 0;
+  unsigned long flightWork = 0;
+  unsigned long end = micros() + RUN_TIME;
+  unsigned long nextInput = micros();
+  unsigned long inputs = 0;
+
+  while(micros() < end)
+  {
+    unsigned long passStart = micros();
+
+    if(micros() >= nextInput)
+    {
+      step(frame, STEPS[inputs++ % (sizeof(STEPS) - 1)]);
+      nextInput += INPUT_PERIOD;
+    }
+
+    start = micros();
+    frame->newBuild();
+    composeTime += micros() - start;
+
+    start = micros();
+    char busy = frame->update();
+    unsigned long spent = micros() - start;
+
+    flushTime += spent;
+    flushWorst = spent > flushWorst ? spent : flushWorst;
+
+    delayMicroseconds(LOOP_WORK);
+
+    // The rest of the pass overlapped a frame still on its way to the panel
+    if(busy)
+    {
+      flightTime += micros() - passStart;
+      flightWork += LOOP_WORK;
+    }
+  }
+
+  printf("bus %lu kHz, %lu us a byte, %d us of other work a pass, an input every %d ms\n", clock / 1000,
+         Wire.byteTime, LOOP_WORK, INPUT_PERIOD / 1000);
+  printf("blocking display()  %8lu us for the whole buffer\n", blocking);
+  printf("frames              %8lu sent, %lu skipped, %lu inputs\n", frame->frameCount, frame->skipCount, inputs);
+  printf("newBuild            %8lu us on the bus\n", composeTime);
+  printf("update()            %8lu us on the bus, worst update %lu us\n", flushTime, flushWorst);
+  printf("frames in flight    %8lu us, %lu us of it other work (%lu%%)\n", flightTime, flightWork,
+         flightTime ? flightWork * 100 / flightTime : 0);
+
+  delete frame;
+
+  if(composeTime)
+  {
+    printf("newBuild waited on the bus\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+// Notes the latency of the input stamped at stamp if the frame has just counted one, in bins worked out from the
+// histogram's definition: bin 0 under 1 ms, bin n from 2^(n-1) up to 2^n ms, the last one everything above
+static void tally(menuFrame * frame, unsigned long * counted, unsigned long stamp, unsigned long * bins,
+                  unsigned long * worst)
+{
+  if(frame->latencyCount == *counted)
+  {
+    return;
+  }
+
+  unsigned long latency = micros() - stamp;
+  unsigned char bin = 0;
+
+  while(bin < LATENCY_BINS - 1 && latency >= (1000UL << bin))
+  {
+    bin++;
+  }
+
+  bins[bin]++;
+  *worst = latency > *worst ? latency : *worst;
+  *counted = frame->latencyCount;
+}
+
+// Plays LATENCY_INPUTS inputs through a fresh frame whose loop does loopWork us of other work a pass, and compares
+// the report printLatency gives with the latencies seen here. Returns 1 if they differ
+static char latency(menuTree * tree, unsigned long loopWork)
+{
+  menuFrame * frame = new menuFrame(tree);
+  unsigned long bins[LATENCY_BINS] = {0};
+  unsigned long worst = 0;
+  unsigned long counted = 0;
+  unsigned long lost = 0;
+  unsigned long seed = loopWork;
+
+  // Let the first frame reach the screen, it shows no input
+  frame->newBuild();
+
+  while(frame->update())
+  {
+  }
+
+  for(int i = 0; i < LATENCY_INPUTS; i++)
+  {
+    // The input lands somewhere in the middle of a pass, and is seen at the start of the next one
+    seed = seed * 1103515245 + 12345;
+    unsigned long stamp = micros() + (seed >> 16) % loopWork;
+    unsigned long before = counted;
+
+    delayMicroseconds(loopWork);
+    frame->stampInput(stamp);
+    step(frame, LATENCY_STEPS[i % (sizeof(LATENCY_STEPS) - 1)]);
+
+    // Run the loop until the input is counted and its frame is on the screen, so the next input is measured alone
+    char busy = 1;
+
+    while((counted == before || busy) && micros() - stamp < LATENCY_LIMIT)
+    {
+      frame->newBuild();
+      tally(frame, &counted, stamp, bins, &worst);
+      busy = frame->update();
+      tally(frame, &counted, stamp, bins, &worst);
+      delayMicroseconds(loopWork);
+    }
+
+    lost += counted != before + 1;
+  }
+
+  // What printLatency should say about them
+  std::string expected = "latency_ms count\n";
+  char line[40];
+
+  for(unsigned char i = 0; i < LATENCY_BINS; i++)
+  {
+    snprintf(line, sizeof(line), i < LATENCY_BINS - 1 ? "<%lu %lu\n" : ">=%lu %lu\n",
+             i < LATENCY_BINS - 1 ? 1UL << i : 1UL << (i - 1), bins[i]);
+    expected += line;
+  }
+
+  snprintf(line, sizeof(line), "worst_us %lu\ninputs %d\n", worst, LATENCY_INPUTS);
+  expected += line;
+
+  Print report;
+  report.file = tmpfile();
+  frame->printLatency(&report);
+
+  std::string printed(ftell(report.file), 0);
+  rewind(report.file);
+  printed.resize(fread(&printed[0], 1, printed.size(), report.file));
+  fclose(report.file);
+
+  delete frame;
+
+  printf("\n%lu us of other work a pass, %d inputs%s\n", loopWork, LATENCY_INPUTS,
+         printed == expected && !lost ? ", histogram as expected" : ", histogram DIFFERENT");
+
+  for(unsigned char i = 0; i < LATENCY_BINS; i++)
+  {
+    if(bins[i])
+    {
+      printf("  %s%-5lu ms %4lu\n", i < LATENCY_BINS - 1 ? "< " : ">=", i < LATENCY_BINS - 1 ? 1UL << i : 1UL << (i - 1),
+             bins[i]);
+    }
+  }
+
+  printf("  worst %lu us\n", worst);
+
+  if(printed != expected || lost)
+  {
+    printf("%lu inputs not counted once each, printLatency gave:\n%s", lost, printed.c_str());
+    return 1;
+  }
+
+  return 0;
+}
+
+int main(int argc, char ** argv)
+{
+  unsigned long clock = argc > 1 ? strtoul(argv[1], NULL, 10) : 400000;
+
+  if(!clock)
+  {
+    fprintf(stderr, "usage: %s [bus clock in Hz]\n", argv[0]);
+    return 2;
+  }
+
+  hostSimulated = true;
+  Wire.setClock(clock);
+
+  static menuTree tree;
+  buildMenus(&tree);
+
+  char failed = overlap(&tree, clock);
+
+  for(unsigned char i = 0; i < sizeof(LATENCY_LOOPS) / sizeof(LATENCY_LOOPS[0]); i++)
+  {
+    failed |= latency(&tree, LATENCY_LOOPS[i]);
+  }
+
+  return failed;
+}
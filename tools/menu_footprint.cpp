@@ -0,0 +1,60 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| menu_footprint.cpp: Host tool that prints how much RAM each part of the scrolling menu library uses for a given
+| configuration. Configuration values are passed as defines, for example:
+|
+|   g++ -std=c++11 -DMAX_NODES=20 -DMAX_MENUS=8 tools/menu_footprint.cpp -o menu_footprint && ./menu_footprint
+|
+| Sizes are for the compiler the tool is built with. Pointers are 2 bytes on AVR, so structures holding pointers
+| come out larger here; the static_assert in the library header is checked with the real target sizes.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#define MENU_DISPLAY    4
+
+#include "../Simple_Menu_Scrolling/Simple_Menu_Scrolling.h"
+#include <stdio.h>
+
+int main()
+{
+    printf("Configuration: MAX_CHAR=%d MAX_NODES=%d MAX_MENUS=%d MAX_ITEMS=%d MAX_DEPTH=%d NODE_PAGE=%d\n",
+           MAX_CHAR, MAX_NODES, MAX_MENUS, MAX_ITEMS, MAX_DEPTH, NODE_PAGE);
+    printf("Pointer size:  %d bytes\n\n", (int) sizeof(void *));
+
+    printf("%-24s %8s %8s %10s\n", "Structure", "Each", "Count", "Total");
+#if NODE_PAGE
+    // Nodes live in the shared page pool, each menu only holds its page table
+    printf("%-24s %8d %8d %10d\n", "menuPage (pool)", (int) sizeof(menuPage), MENU_PAGES, (int) POOL_RAM);
+#else
+    printf("%-24s %8d %8d %10d\n", "menuNode", (int) sizeof(menuNode), MAX_NODES * MAX_MENUS,
+           (int) (sizeof(menuNode) * MAX_NODES * MAX_MENUS));
+#endif
+    // Where a node's bytes go. The name is held in the node, so nodes labelled from a language table (NODE_TEXT) only
+    // use two of its MAX_CHAR bytes, for the string ID
+    printf("\n%-24s %8d bytes:\n", "Each menuNode", (int) sizeof(menuNode));
+    printf("  %-22s %8d (2 used by NODE_TEXT nodes)\n", "name", MAX_CHAR);
+    printf("  %-22s %8d\n", "type, flags, target", 2);
+    printf("  %-22s %8d\n", "width, context", 2);
+#if MENU_ICONS
+    printf("  %-22s %8d\n", "icon", 1);
+#endif
+    printf("  %-22s %8d\n\n", "padding", (int) sizeof(menuNode) - MAX_CHAR - 4 - MENU_ICONS);
+
+    printf("%-24s %8d %8d %10d\n", "menu", (int) sizeof(menu), MAX_MENUS, (int) (sizeof(menu) * MAX_MENUS));
+    printf("%-24s %8d %8d %10d\n", "menuTree", (int) sizeof(menuTree), 1, (int) sizeof(menuTree));
+    printf("%-24s %8d %8d %10d\n", "menuFrame (w/o display)", (int) (sizeof(menuFrame) - sizeof(menuDisplay)),
+           MENU_FRAMES, (int) ((sizeof(menuFrame) - sizeof(menuDisplay)) * MENU_FRAMES));
+
+    // Display buffers for each backend, since the tool is only built with one of them
+    printf("\nDisplay buffer per frame:\n");
+    printf("%-24s %8d\n", "SSD1306 128x64", 128 * 64 / 8);
+    printf("%-24s %8d\n", "SSD1306 128x32", 128 * 32 / 8);
+    printf("%-24s %8d\n", "LCD / Serial", 0);
+    printf("%-24s %8d\n", "Text buffer", (int) sizeof(menuDisplay));
+
+    printf("\nTotal without display:   %d bytes (add the display buffer for each frame)\n",
+           (int) (sizeof(menuTree) + POOL_RAM + MENU_FRAMES * (sizeof(menuFrame) - sizeof(menuDisplay))));
+
+    return 0;
+}
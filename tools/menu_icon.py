@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""menu_icon.py: Turns ASCII art into run-length coded node icons (see menuIcon in Simple_Menu_Scrolling.h).
+
+Each file holds one icon, up to 8 lines tall: '#' or 'X' is a lit pixel, anything else is dark. The icon is named
+after the file, and an icon table listing them in the order given is written after them, for example:
+
+    python3 tools/menu_icon.py icons/gear.txt icons/play.txt > Menu_Icons.h
+
+gives ICON_GEAR and ICON_PLAY, and ICONS, where node icon slot 1 is ICON_GEAR and slot 2 is ICON_PLAY. Each icon
+is decoded again before it is written to make sure it comes back the same, and its size is noted next to the size
+it would be stored as raw columns.
+
+Only the standard library is used.
+
+Created by:     Cameron Jupp
+Date Started:   October 19, 2026
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# Pixels in a column (one page of the display), and the longest run or literal a packet header can hold
+HEIGHT = 8
+PACKET = 0x7F
+REPEAT = 0x80
+
+
+def columns(lines):
+    """Packs the art into column bytes, least significant bit at the top."""
+    lines = [line.rstrip('\n') for line in lines]
+
+    # Blank lines after the art are left off, blank lines within it are dark rows
+    while lines and not lines[-1].strip():
+        lines.pop()
+
+    if len(lines) > HEIGHT:
+        raise ValueError('icons are at most %d lines tall, this one is %d' % (HEIGHT, len(lines)))
+
+    width = max((len(line) for line in lines), default=0)
+
+    if not 0 < width <= 255:
+        raise ValueError('icons are 1 to 255 columns wide, this one is %d' % width)
+
+    packed = []
+
+    for x in range(width):
+        byte = 0
+
+        for y, line in enumerate(lines):
+            if x < len(line) and line[x] in '#X':
+                byte |= 1 << y
+
+        packed.append(byte)
+
+    return packed
+
+
+def encode(packed):
+    """Run-length codes the columns. Runs of three or more become a repeat packet, the rest go out as they are."""
+    out = [len(packed)]
+    literal = []
+    i = 0
+
+    def flush():
+        while literal:
+            chunk = literal[:PACKET]
+            del literal[:PACKET]
+            out.append(len(chunk))
+            out.extend(chunk)
+
+    while i < len(packed):
+        run = 1
+
+        while i + run < len(packed) and packed[i + run] == packed[i] and run < PACKET:
+            run += 1
+
+        if run >= 3:
+            flush()
+            out.extend([REPEAT | run, packed[i]])
+            i += run
+        else:
+            literal.extend(packed[i:i + run])
+            i += run
+
+    flush()
+    return out
+
+
+def decode(data):
+    """Unpacks an icon the same way menuIconReader does."""
+    width = data[0]
+    at = 1
+    packed = []
+
+    while len(packed) < width:
+        header = data[at]
+        at += 1
+        count = header & PACKET
+
+        if header & REPEAT:
+            packed.extend([data[at]] * count)
+            at += 1
+        else:
+            packed.extend(data[at:at + count])
+            at += count
+
+    return packed[:width]
+
+
+def symbol(path):
+    return 'ICON_' + re.sub(r'\W', '_', os.path.splitext(os.path.basename(path))[0]).upper()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('files', nargs='+', help='ASCII art files, one icon each')
+    parser.add_argument('--table', default='ICONS', help='name of the icon table (default ICONS)')
+    args = parser.parse_args()
+
+    names = []
+
+    for path in args.files:
+        with open(path) as art:
+            packed = columns(art.readlines())
+
+        data = encode(packed)
+
+        if decode(data) != packed:
+            sys.exit('%s: the icon did not decode to the same columns' % path)
+
+        names.append(symbol(path))
+        print('// %s: %d columns, %d bytes (%d raw)' % (os.path.basename(path), len(packed), len(data),
+                                                      len(packed) + 1))
+        print('const unsigned char %s[] PROGMEM = {%s};' % (names[-1], ', '.join('0x%02X' % b for b in data)))
+
+    print()
+    print('const menuIcon %s[] PROGMEM = {%s};' % (args.table, ', '.join(names)))
+
+
+if __name__ == '__main__':
+    main()
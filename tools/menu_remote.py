@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+"""menu_remote.py: Host client for the menu remote control protocol (see Simple_Menu_Scrolling/Menu_Remote.h).
+
+Drives a menu frame over a serial port or pseudo-terminal and reads its state back, for example:
+
+    python3 tools/menu_remote.py /dev/ttyUSB0 nav ddc
+    python3 tools/menu_remote.py /dev/ttyUSB0 jump 2 5
+    python3 tools/menu_remote.py /dev/ttyUSB0 state
+    python3 tools/menu_remote.py /dev/ttyUSB0 text
+    python3 tools/menu_remote.py /dev/ttyUSB0 dump screen.pbm
+
+Only the standard library is used. The port is put in raw mode; set the baud rate with --baud.
+
+tools/menu_serve.cpp serves a menu on a pseudo-terminal to run this against without a board, and
+tools/menu_remote_check.py checks the protocol through it.
+
+Created by:     Cameron Jupp
+Date Started:   October 19, 2026
+"""
+
+import argparse
+import os
+import select
+import struct
+import sys
+import termios
+import tty
+
+SOF = 0x7E
+REPLY = 0x80
+
+NAV = 0x01
+JUMP = 0x02
+STATE = 0x03
+TEXT = 0x04
+DUMP = 0x05
+
+STATUS = {0: "ok", 1: "unknown command", 2: "bad argument", 3: "bad CRC", 4: "frame too long"}
+
+# SSD1306 frame buffer: 128 columns by 8 pages of 8 rows, one byte per column of a page
+OLED_WIDTH = 128
+OLED_HEIGHT = 64
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT, polynomial 0x1021, as worked out by menuCrcStep."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+class MenuRemote:
+    """One connection to a menuRemote."""
+
+    def __init__(self, path, baud=115200, timeout=1.0):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        self.timeout = timeout
+
+        if os.isatty(self.fd):
+            tty.setraw(self.fd)
+            speed = getattr(termios, "B%d" % baud, None)
+            if speed is not None:
+                attrs = termios.tcgetattr(self.fd)
+                attrs[4] = attrs[5] = speed
+                termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+
+    def close(self):
+        os.close(self.fd)
+
+    def _read(self, count):
+        data = b""
+        while len(data) < count:
+            ready, _, _ = select.select([self.fd], [], [], self.timeout)
+            if not ready:
+                raise TimeoutError("no reply from the menu")
+            data += os.read(self.fd, count - len(data))
+        return data
+
+    def send(self, command, payload=b""):
+        """Sends one command frame without waiting for its reply."""
+        body = bytes([len(payload), command]) + payload
+        os.write(self.fd, bytes([SOF]) + body + struct.pack(">H", crc16(body)))
+
+    def receive(self, command):
+        """Reads the reply to a command sent earlier and returns its payload after the status byte."""
+        # Skip anything before the start of the reply
+        while self._read(1)[0] != SOF:
+            pass
+
+        length, reply = self._read(2)
+        data = self._read(length)
+        (crc,) = struct.unpack(">H", self._read(2))
+
+        if crc != crc16(bytes([length, reply]) + data):
+            raise IOError("reply failed its CRC")
+        if reply != command | REPLY:
+            raise IOError("reply to command 0x%02X, expected 0x%02X" % (reply & ~REPLY, command))
+        if data[0]:
+            raise IOError(STATUS.get(data[0], "status %d" % data[0]))
+
+        return data[1:]
+
+    def request(self, command, payload=b""):
+        """Sends one command and returns the payload of its reply after the status byte."""
+        self.send(command, payload)
+        return self.receive(command)
+
+    def nav(self, steps):
+        """Applies a batch of navigation steps (see Menu_Remote.h), returning how many were done."""
+        return self.request(NAV, steps.encode("ascii"))[0]
+
+    def jump(self, menu, node):
+        self.request(JUMP, struct.pack("<HH", menu, node))
+
+    def state(self):
+        names = ("menu", "node", "start", "arrow", "depth", "editing", "idle")
+        return dict(zip(names, struct.unpack("<HHHHBBB", self.request(STATE))))
+
+    def text(self, reply=None):
+        """Returns the title and the visible labels, from the reply given or a new request."""
+        reply = self.request(TEXT) if reply is None else reply
+        return [part.decode("latin-1") for part in reply.split(b"\0")[:-1]]
+
+    def dump(self):
+        """Returns the whole display buffer, asking for it a chunk at a time."""
+        data = b""
+        while True:
+            reply = self.request(DUMP, struct.pack("<H", len(data)))
+            offset, size = struct.unpack("<HH", reply[:4])
+            data += reply[4:]
+            if len(data) >= size or len(reply) == 4:
+                return data
+
+
+def write_pbm(path, buffer):
+    """Writes an SSD1306 frame buffer out as a plain PBM image."""
+    with open(path, "w") as out:
+        out.write("P1\n%d %d\n" % (OLED_WIDTH, OLED_HEIGHT))
+        for y in range(OLED_HEIGHT):
+            row = (buffer[(y // 8) * OLED_WIDTH + x] >> (y % 8) & 1 for x in range(OLED_WIDTH))
+            out.write(" ".join(str(bit) for bit in row) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("port")
+    parser.add_argument("--baud", type=int, default=115200)
+    commands = parser.add_subparsers(dest="command", required=True)
+    commands.add_parser("nav").add_argument("steps")
+    jump = commands.add_parser("jump")
+    jump.add_argument("menu", type=int)
+    jump.add_argument("node", type=int)
+    commands.add_parser("state")
+    commands.add_parser("text")
+    commands.add_parser("dump").add_argument("out", nargs="?")
+    args = parser.parse_args()
+
+    remote = MenuRemote(args.port, args.baud)
+
+    if args.command == "nav":
+        print(remote.nav(args.steps))
+    elif args.command == "jump":
+        remote.jump(args.menu, args.node)
+    elif args.command == "state":
+        print(" ".join("%s=%d" % item for item in remote.state().items()))
+    elif args.command == "text":
+        print("\n".join(remote.text()))
+    elif args.command == "dump":
+        buffer = remote.dump()
+        if args.out and len(buffer) == OLED_WIDTH * OLED_HEIGHT // 8:
+            write_pbm(args.out, buffer)
+        elif args.out:
+            open(args.out, "wb").write(buffer)
+        else:
+            sys.stdout.buffer.write(buffer)
+
+    remote.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""menu_remote_check.py: Scripted client for tools/menu_serve.cpp, checking the remote control protocol end to end.
+
+menu_serve runs it with the pseudo-terminal it serves on as the last argument:
+
+    ./menu_serve python3 tools/menu_remote_check.py
+
+Each check prints a line; the script exits with 1 if any of them failed. The checks know the menus menu_serve builds.
+
+Created by:     Cameron Jupp
+Date Started:   October 19, 2026
+"""
+
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from menu_remote import DUMP, JUMP, NAV, SOF, STATE, TEXT, MenuRemote, crc16
+
+failures = 0
+
+
+def check(name, got, expected):
+    global failures
+    if got == expected:
+        print("ok    %s" % name)
+    else:
+        print("FAIL  %s: got %r, expected %r" % (name, got, expected))
+        failures += 1
+
+
+def error(name, action, expected):
+    """Checks that action fails with the status expected."""
+    try:
+        action()
+        check(name, "ok", expected)
+    except IOError as problem:
+        check(name, str(problem), expected)
+
+
+def main():
+    remote = MenuRemote(sys.argv[-1])
+
+    state = remote.state()
+    check("state at start", (state["menu"], state["node"], state["start"], state["depth"]), (0, 0, 0, 0))
+    check("text at start", remote.text(), ["Main", "Settings", "Start", "Level", "A label too long to fit"])
+
+    check("nav down twice", remote.nav("dd"), 2)
+    check("node after nav", remote.state()["node"], 2)
+    check("nav into Settings", remote.nav("uuc"), 3)
+    check("text in Settings", remote.text(), ["Settings", "Contrast", "Sleep", "Language", "Units"])
+    error("nav stops at a bad step", lambda: remote.nav("dxd"), "bad argument")
+    check("steps before it done", remote.state()["node"], 1)
+    check("nav back", remote.nav("b"), 1)
+
+    remote.jump(1, 4)
+    state = remote.state()
+    check("jump", (state["menu"], state["node"]), (1, 4))
+    error("jump past the last menu", lambda: remote.jump(200, 0), "bad argument")
+    error("jump past the last node", lambda: remote.jump(1, 200), "bad argument")
+
+    check("dump holds the title", b"Settings" in remote.dump(), True)
+    check("dump starts at the offset", struct.unpack("<H", remote.request(DUMP, struct.pack("<H", 16))[:2])[0], 16)
+
+    # A frame whose CRC is wrong is answered with the command it claimed
+    body = bytes([0, STATE])
+    os.write(remote.fd, bytes([SOF]) + body + struct.pack(">H", crc16(body) ^ 1))
+    error("bad CRC", lambda: remote.receive(STATE), "bad CRC")
+    error("unknown command", lambda: remote.request(0x33), "unknown command")
+    error("payload too long", lambda: remote.request(NAV, b"d" * 33), "frame too long")
+    check("still answering", remote.state()["menu"], 1)
+
+    # Shorten removes every node of Settings but two, through another frame. The text asked for in the same poll,
+    # before this frame has built again, must fit the window to what is left
+    remote.jump(1, 6)
+    check("window at the end of Settings", remote.state()["start"], 3)
+    remote.send(NAV, b"c")
+    remote.send(TEXT)
+    check("nav Shorten", remote.receive(NAV)[0], 1)
+    check("text after Shorten", remote.text(remote.receive(TEXT)), ["Settings", "Contrast", "Sleep"])
+    state = remote.state()
+    check("cursor after Shorten", (state["node"], state["start"]), (1, 0))
+
+    remote.close()
+    print("%d checks failed" % failures if failures else "all checks passed")
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
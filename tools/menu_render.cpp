@@ -0,0 +1,414 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| menu_render.cpp: Host tool that plays scripted navigation sessions through the scrolling menu library and records
+| every frame newBuild draws, so a change to the render path can be checked against the frames drawn before it.
+| The library is built in with the text buffer display backend:
+|
+|   g++ -std=gnu++11 -Itools/host tools/menu_render.cpp -o menu_render
+|   ./menu_render check tools/menu_render.golden
+|
+| check stops at the first frame of each session that differs, writes the expected and drawn frames next to each
+| other into <file>.fail and exits with 1. record writes the file instead; a change meant to alter what is drawn
+| records the golden files again and commits them with it. Both modes print the time each session spent in newBuild.
+|
+| With the text buffer, frames are compared as the text it holds: what is drawn and in which state. Built with
+| -DMENU_DISPLAY=1, the SSD1306 backend is used instead, with the mock panel in tools/host/OLED_Tools.h. Each frame is
+| sent to the panel over the mock bus as the main loop would send it, and the pixels the panel then shows are compared
+| (tools/menu_render_ssd1306.golden). This also catches changes that never reach the screen. A differing frame is
+| written to <file>.<session>.pbm too, expected on the left and drawn on the right.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef MENU_DISPLAY
+#define MENU_DISPLAY    4
+#endif
+#define MAX_CHAR        24
+#define MAX_ITEMS       4
+
+// Nodes are held in pages from the shared pool, so sessions that build the tree again (and restarts) also check that
+// the pages of the old tree go back to it
+#define NODE_PAGE       4
+
+#include "../Simple_Menu_Scrolling/Simple_Menu_Scrolling.cpp"
+#include "../Simple_Menu_Scrolling/Menu_Remote.cpp"
+#include "../Simple_Menu_Scrolling/Menu_Store.cpp"
+#include "../Simple_Menu_Scrolling/Menu_Display_SSD1306.cpp"
+
+#include <stdlib.h>
+#include <string>
+
+// A session is a name and its steps: u(p), d(own), c(hoose), b(ack) and r(estart). A restart saves where the frame
+// is, builds the menus and the frame again from nothing and restores the position, as after a reset
+struct session
+{
+  const char * name;
+  const char * steps;
+};
+
+static const session SESSIONS[] =
+{
+  {"scroll", "dddddddddddduuuuuuuuuuuu"},
+  {"enter",  "cdddcbdddbbcdddddddbuuc"},
+  {"edit",   "ddcuuuuduccuuub"},
+  {"mixed",  "ddddcddbdddcbbuuuucdcbddc"},
+  {"resume", "ddddddruuuuuucdddrbr"},
+};
+
+static char noAction()
+{
+  return 0;
+}
+
+static menuValue level = {50, 0, 100, 5, 0, NULL};
+static menuValue trim = {-125, -500, 500, 25, 2, NULL};
+
+// The menus every session starts from: a main menu longer than the window, a submenu and some values
+static void buildMenus(menuTree * tree)
+{
+  tree->addMenu((char *) "Main", 0);
+  tree->addNode((char *) "Settings", SUB_NODE, NULL);
+  tree->linkNode(1);
+  tree->addNode((char *) "Start", ACT_NODE, noAction);
+  tree->addValue("Level", &level);
+  tree->addNode((char *) "A label too long to fit", ACT_NODE, noAction);
+  tree->addNode((char *) "Stop", ACT_NODE, noAction);
+  tree->addNode((char *) "Reset", ACT_NODE, noAction);
+  tree->addNode((char *) "About", ACT_NODE, noAction);
+
+  tree->addMenu((char *) "Settings", 1);
+  tree->addValue("Trim", &trim);
+  tree->addNode((char *) "Contrast", ACT_NODE, noAction);
+  tree->addNode((char *) "Sleep", ACT_NODE, noAction);
+  tree->addNode((char *) "Language", ACT_NODE, noAction);
+  tree->addNode((char *) "Units", ACT_NODE, noAction);
+}
+
+#if MENU_DISPLAY == DISPLAY_SSD1306
+
+// What the panel showed after the previous frame of the session, so only the pages that changed are written
+static uint8_t lastPanel[PANEL_BYTES];
+
+// Starts a session on a blank panel
+static void blank()
+{
+  memset(oledPanel.ram, 0, sizeof(oledPanel.ram));
+  memset(lastPanel, 0, sizeof(lastPanel));
+  oledDisplay.clearDisplay();
+}
+
+// Sends the frame to the panel a chunk at a time, as menuFrame::update would. The marquee is left alone so the frames
+// don't depend on timing
+static void send(menuFrame * frame)
+{
+  while(frame->display.update())
+  {
+  }
+}
+
+// Adds the pages of the panel that changed since the previous frame to the transcript, one line of hex each
+static void capture(menuFrame *, char step, std::string * out)
+{
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+
+  out->append("step ").push_back(step);
+  out->append("\n");
+
+  for(int page = 0; page < PANEL_HEIGHT / 8; page++)
+  {
+    const uint8_t * shown = &oledPanel.ram[page * PANEL_WIDTH];
+
+    if(!memcmp(shown, &lastPanel[page * PANEL_WIDTH], PANEL_WIDTH))
+    {
+      continue;
+    }
+
+    out->append("page ").push_back('0' + page);
+    out->push_back(' ');
+
+    for(int i = 0; i < PANEL_WIDTH; i++)
+    {
+      out->push_back(HEX_DIGITS[shown[i] >> 4]);
+      out->push_back(HEX_DIGITS[shown[i] & 15]);
+    }
+
+    out->append("\n");
+  }
+
+  memcpy(lastPanel, oledPanel.ram, sizeof(lastPanel));
+}
+
+// Builds what the panel showed at the end of a frame from a transcript, by applying the page lines of the session from
+// its first frame (at start) up to the end of that frame
+static void replay(const std::string & text, size_t start, size_t end, uint8_t * ram)
+{
+  memset(ram, 0, PANEL_BYTES);
+
+  for(size_t at = text.find("page ", start); at < end; at = text.find("page ", at + 1))
+  {
+    int page = text[at + 5] - '0';
+
+    for(int i = 0; i < PANEL_WIDTH; i++)
+    {
+      ram[page * PANEL_WIDTH + i] = strtoul(text.substr(at + 7 + i * 2, 2).c_str(), NULL, 16);
+    }
+  }
+}
+
+// Writes two panels side by side as a PBM picture, lit pixels black
+static void picture(const std::string & name, const uint8_t * left, const uint8_t * right)
+{
+  FILE * out = fopen(name.c_str(), "w");
+
+  if(!out)
+  {
+    return;
+  }
+
+  fprintf(out, "P1\n%d %d\n", PANEL_WIDTH * 2 + 8, PANEL_HEIGHT);
+
+  for(int y = 0; y < PANEL_HEIGHT; y++)
+  {
+    for(int x = 0; x < PANEL_WIDTH * 2 + 8; x++)
+    {
+      const uint8_t * ram = x < PANEL_WIDTH ? left : right;
+      int column = x < PANEL_WIDTH ? x : x - PANEL_WIDTH - 8;
+      char lit = column >= 0 && ram[y / 8 * PANEL_WIDTH + column] >> (y & 7) & 1;
+
+      fputc(lit ? '1' : '0', out);
+    }
+
+    fputc('\n', out);
+  }
+
+  fclose(out);
+}
+
+#else
+
+static void blank() {}
+
+static void send(menuFrame *) {}
+
+// Adds what the display shows to the transcript
+static void capture(menuFrame * frame, char step, std::string * out)
+{
+  out->append("step ").push_back(step);
+  out->append("\n");
+
+  for(int i = 0; i <= MAX_ITEMS; i++)
+  {
+    out->append("|").append(frame->display.text[i]).append("|\n");
+  }
+}
+
+#endif
+
+// Plays one session from a fresh tree, returning its transcript and the time spent building frames (us)
+static std::string play(const session * s, unsigned long * buildTime)
+{
+  static menuTree tree;
+  tree = menuTree();
+  level.value = 50;
+  trim.value = -125;
+  buildMenus(&tree);
+
+  // Every session starts with erased storage and a blank screen
+  EEPROM.file = tmpfile();
+  blank();
+
+  menuFrame * frame = new menuFrame(&tree);
+  menuStore * store = new menuStore(frame);
+  store->restore();
+
+  std::string out = std::string("session ") + s->name + "\n";
+
+  *buildTime = 0;
+
+  // The first frame is the one shown before any input, marked with a '-'
+  for(int i = -1; i < (int) strlen(s->steps); i++)
+  {
+    char input = i < 0 ? '-' : s->steps[i];
+
+    switch(input)
+    {
+      case 'u': frame->newUp(); break;
+      case 'd': frame->newDown(); break;
+      case 'c': frame->choose(); break;
+      case 'b': frame->back(); break;
+
+      case 'r':
+      store->save();
+      delete store;
+      delete frame;
+
+      tree = menuTree();
+      buildMenus(&tree);
+      frame = new menuFrame(&tree);
+      store = new menuStore(frame);
+      store->restore();
+      break;
+    }
+
+    unsigned long start = micros();
+    frame->newBuild();
+    *buildTime += micros() - start;
+
+    send(frame);
+    capture(frame, input, &out);
+  }
+
+  delete store;
+  delete frame;
+  fclose(EEPROM.file);
+  EEPROM.file = NULL;
+
+  return out;
+}
+
+// Finds the end of the frame starting at start. Frames end where the next "step" or "session" line starts
+static size_t frameEnd(const std::string & text, size_t start)
+{
+  size_t next = text.find("\ns", start);
+
+  return next == std::string::npos ? text.size() : next + 1;
+}
+
+int main(int argc, char ** argv)
+{
+  if(argc != 3 || (strcmp(argv[1], "record") && strcmp(argv[1], "check")))
+  {
+    fprintf(stderr, "usage: %s record|check <golden file>\n", argv[0]);
+    return 2;
+  }
+
+  char record = !strcmp(argv[1], "record");
+  std::string golden;
+
+  if(!record)
+  {
+    FILE * in = fopen(argv[2], "r");
+
+    if(!in)
+    {
+      fprintf(stderr, "can't read %s\n", argv[2]);
+      return 2;
+    }
+
+    char block[256];
+    size_t got;
+
+    while((got = fread(block, 1, sizeof(block), in)) > 0)
+    {
+      golden.append(block, got);
+    }
+
+    fclose(in);
+  }
+
+  std::string transcript;
+  std::string failures;
+  int failed = 0;
+
+  for(size_t i = 0; i < sizeof(SESSIONS) / sizeof(SESSIONS[0]); i++)
+  {
+    unsigned long buildTime;
+    std::string out = play(&SESSIONS[i], &buildTime);
+    size_t frames = strlen(SESSIONS[i].steps) + 1;
+
+    printf("%-8s %4u frames %8lu us in newBuild (%lu us each)", SESSIONS[i].name, (unsigned) frames, buildTime,
+           buildTime / frames);
+
+    transcript += out;
+
+    if(record)
+    {
+      printf("\n");
+      continue;
+    }
+
+    // Compare frame by frame against the same session in the golden file
+    size_t expected = golden.find(out.substr(0, out.find('\n') + 1));
+    size_t drawn = out.find('\n') + 1;
+    char same = expected != std::string::npos;
+
+    if(same)
+    {
+      expected += drawn;
+    }
+
+    size_t expectedStart = expected;
+    size_t drawnStart = drawn;
+
+    while(same && drawn < out.size())
+    {
+      size_t drawnEnd = frameEnd(out, drawn);
+      size_t expectedEnd = frameEnd(golden, expected);
+
+      if(out.compare(drawn, drawnEnd - drawn, golden, expected, expectedEnd - expected))
+      {
+        failures += std::string("session ") + SESSIONS[i].name + "\n--- expected\n" +
+                    golden.substr(expected, expectedEnd - expected) + "--- drawn\n" +
+                    out.substr(drawn, drawnEnd - drawn) + "\n";
+        same = 0;
+
+#if MENU_DISPLAY == DISPLAY_SSD1306
+        uint8_t expectedPanel[PANEL_BYTES];
+        uint8_t drawnPanel[PANEL_BYTES];
+
+        replay(golden, expectedStart, expectedEnd, expectedPanel);
+        replay(out, drawnStart, drawnEnd, drawnPanel);
+        std::string name = std::string(argv[2]) + "." + SESSIONS[i].name + ".pbm";
+
+        picture(name, expectedPanel, drawnPanel);
+        failures += "--- picture in " + name + "\n\n";
+#else
+        (void) expectedStart;
+        (void) drawnStart;
+#endif
+      }
+
+      drawn = drawnEnd;
+      expected = expectedEnd;
+    }
+
+    if(expected == std::string::npos)
+    {
+      failures += std::string("session ") + SESSIONS[i].name + " is not in the golden file\n\n";
+    }
+
+    printf("  %s\n", same ? "same" : "DIFFERENT");
+    failed += !same;
+  }
+
+  if(record)
+  {
+    FILE * out = fopen(argv[2], "w");
+
+    if(!out || fwrite(transcript.data(), 1, transcript.size(), out) != transcript.size())
+    {
+      fprintf(stderr, "can't write %s\n", argv[2]);
+      return 2;
+    }
+
+    fclose(out);
+    return 0;
+  }
+
+  if(failed)
+  {
+    std::string name = std::string(argv[2]) + ".fail";
+    FILE * out = fopen(name.c_str(), "w");
+
+    if(out)
+    {
+      fwrite(failures.data(), 1, failures.size(), out);
+      fclose(out);
+    }
+
+    printf("%d session(s) drew different frames, see %s\n", failed, name.c_str());
+    return 1;
+  }
+
+  return 0;
+}
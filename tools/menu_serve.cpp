@@ -0,0 +1,170 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| menu_serve.cpp: Host tool that serves a menu frame over the remote control protocol (see Menu_Remote.h) on a
+| pseudo-terminal, so tools/menu_remote.py can be run against the library without a board:
+|
+|   g++ -std=gnu++11 -Itools/host tools/menu_serve.cpp -o menu_serve -lutil
+|   ./menu_serve                                        (prints the terminal to connect to, serves until killed)
+|   ./menu_serve python3 tools/menu_remote_check.py     (runs the command with the terminal added, then stops)
+|
+| With a command, the tool exits with the command's status once it is done, so a scripted client such as
+| tools/menu_remote_check.py checks the protocol end to end.
+|
+| The loop is the one a sketch runs: poll the remote, then newBuild and update(). A second frame on the same tree
+| stands for another display; the last node of Settings removes nodes through it, so the remote sees a menu shortened
+| under its window before its own frame has built again.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#define MENU_DISPLAY    4
+#define MAX_CHAR        24
+#define MAX_ITEMS       4
+
+#include "../Simple_Menu_Scrolling/Simple_Menu_Scrolling.cpp"
+#include "../Simple_Menu_Scrolling/Menu_Remote.cpp"
+
+#include <pty.h>
+#include <sys/ioctl.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+#include <vector>
+
+// A Stream on the controlling side of the pseudo-terminal
+class ptyStream : public Stream
+{
+  public:
+
+  int fd = -1;
+
+  int available()
+  {
+    int count = 0;
+
+    return ioctl(fd, FIONREAD, &count) ? 0 : count;
+  }
+
+  int read()
+  {
+    unsigned char byte;
+
+    return ::read(fd, &byte, 1) == 1 ? byte : -1;
+  }
+
+  size_t write(uint8_t c)
+  {
+    return ::write(fd, &c, 1) == 1;
+  }
+};
+
+static menuTree tree;
+static menuFrame * other;
+
+static char noAction()
+{
+  return 0;
+}
+
+// Removes every node of Settings after the first two, this one included, through the other frame
+static char shorten()
+{
+  while(tree.menuList[1].nodeCount > 2)
+  {
+    other->delNode(1, tree.menuList[1].nodeCount - 1);
+  }
+
+  return 0;
+}
+
+static menuValue level = {50, 0, 100, 5, 0, NULL};
+
+static void buildMenus()
+{
+  tree.addMenu((char *) "Main", 0);
+  tree.addNode((char *) "Settings", SUB_NODE, NULL);
+  tree.linkNode(1);
+  tree.addNode((char *) "Start", ACT_NODE, noAction);
+  tree.addValue("Level", &level);
+  tree.addNode((char *) "A label too long to fit", ACT_NODE, noAction);
+  tree.addNode((char *) "Stop", ACT_NODE, noAction);
+  tree.addNode((char *) "Reset", ACT_NODE, noAction);
+  tree.addNode((char *) "About", ACT_NODE, noAction);
+
+  tree.addMenu((char *) "Settings", 1);
+  tree.addNode((char *) "Contrast", ACT_NODE, noAction);
+  tree.addNode((char *) "Sleep", ACT_NODE, noAction);
+  tree.addNode((char *) "Language", ACT_NODE, noAction);
+  tree.addNode((char *) "Units", ACT_NODE, noAction);
+  tree.addNode((char *) "Timeout", ACT_NODE, noAction);
+  tree.addNode((char *) "Brightness", ACT_NODE, noAction);
+  tree.addNode((char *) "Shorten", ACT_NODE, shorten);
+}
+
+int main(int argc, char ** argv)
+{
+  buildMenus();
+
+  static menuFrame frame(&tree);
+  static menuFrame second(&tree);
+  other = &second;
+
+  // Raw, so the protocol's bytes go through the terminal untouched
+  struct termios raw;
+  int device;
+  char name[64];
+  ptyStream port;
+
+  memset(&raw, 0, sizeof(raw));
+  cfmakeraw(&raw);
+
+  if(openpty(&port.fd, &device, name, &raw, NULL))
+  {
+    perror("openpty");
+    return 2;
+  }
+
+  static menuRemote remote(&frame, &port);
+  pid_t client = 0;
+
+  if(argc > 1)
+  {
+    client = fork();
+
+    if(!client)
+    {
+      std::vector<char *> args(argv + 1, argv + argc);
+      args.push_back(name);
+      args.push_back(NULL);
+      execvp(args[0], &args[0]);
+      perror(args[0]);
+      _exit(127);
+    }
+  }
+
+  else
+  {
+    printf("serving on %s\n", name);
+    fflush(stdout);
+  }
+
+  for(;;)
+  {
+    remote.poll();
+    frame.newBuild();
+
+    while(frame.update())
+    {
+    }
+
+    int status;
+
+    if(client && waitpid(client, &status, WNOHANG) == client)
+    {
+      printf("%lu frames handled, %lu dropped\n", remote.frameCount, remote.errorCount);
+      return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+    }
+
+    usleep(1000);
+  }
+}
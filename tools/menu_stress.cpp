@@ -0,0 +1,258 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| menu_stress.cpp: Host tool that hammers a menuQueue from another thread while a frame keeps building, to check that
+| edits made outside the render loop never tear a label or leave a menu with a count it shouldn't have:
+|
+|   g++ -std=gnu++11 -pthread -Itools/host tools/menu_stress.cpp -o menu_stress
+|   ./menu_stress [edits]
+|
+| Building with -fsanitize=thread as well also checks the queue for data races. Every frame drawn is checked as it
+| is built, and once the producer is done the tree is compared with the same edits made one at a time. Exits with 1
+| on the first problem found.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#define MENU_DISPLAY    4
+#define MAX_CHAR        24
+#define MAX_ITEMS       4
+
+#include "../Simple_Menu_Scrolling/Simple_Menu_Scrolling.cpp"
+
+#include <stdlib.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Nodes in the menu being edited. Nodes are deleted from anywhere in the menu and added back at the end, keeping the
+// menu between NODES - SHRINK and NODES nodes
+#define NODES           12
+#define SHRINK          3
+
+static char noAction()
+{
+  return 0;
+}
+
+static void buildMenus(menuTree * tree)
+{
+  tree->addMenu((char *) "T00000-00000", 0);
+
+  for(int i = 0; i < NODES; i++)
+  {
+    char name[MAX_CHAR];
+
+    snprintf(name, sizeof(name), "N%05d-%05d", i, i);
+    tree->addNode(name, ACT_NODE, noAction);
+  }
+}
+
+// Labels carry the same number twice, so a label read while it was being copied shows up as two different numbers
+static char wellFormed(const char * label)
+{
+  unsigned first, second;
+  char kind;
+
+  return sscanf(label, "%c%u-%u", &kind, &first, &second) == 3 && first == second;
+}
+
+// Set by the producer once its last edit is queued
+static std::atomic<bool> finished(false);
+
+// Queues an edit, waiting for room instead of dropping it so every edit made is known, and logs it if given a log
+static void push(menuQueue * queue, std::vector<menuEdit> * log, const menuEdit & edit)
+{
+  for(;;)
+  {
+    char queued = 0;
+
+    switch(edit.code)
+    {
+      case EDIT_NODE_NAME: queued = queue->setName(edit.menuNum, edit.nodeNum, edit.name); break;
+      case EDIT_MENU_NAME: queued = queue->setTitle(edit.menuNum, edit.name); break;
+      case EDIT_DEL_NODE:  queued = queue->delNode(edit.menuNum, edit.nodeNum); break;
+      case EDIT_ADD_NODE:  queued = queue->addNode(edit.name, edit.menuNum, edit.nodeType, edit.action); break;
+    }
+
+    if(queued && log)
+    {
+      log->push_back(edit);
+    }
+
+    if(queued)
+    {
+      return;
+    }
+
+    std::this_thread::yield();
+  }
+}
+
+// The producer: renames nodes, retitles the menu, deletes nodes from anywhere in it and adds nodes to the bottom
+static void produce(menuQueue * queue, std::vector<menuEdit> * log, unsigned long count)
+{
+  unsigned long seed = 12345;
+
+  // Nodes in the menu once every edit queued so far is made
+  unsigned size = NODES;
+
+  for(unsigned long i = 0; i < count; i++)
+  {
+    menuEdit edit;
+
+    memset(&edit, 0, sizeof(edit));
+    seed = seed * 1103515245 + 12345;
+
+    switch((seed >> 16) % 4)
+    {
+      case 0:
+      case 1:
+      edit.code = EDIT_NODE_NAME;
+      edit.nodeNum = (seed >> 8) % size;
+      snprintf(edit.name, sizeof(edit.name), "N%05lu-%05lu", i % 100000, i % 100000);
+      break;
+
+      case 2:
+      edit.code = EDIT_MENU_NAME;
+      snprintf(edit.name, sizeof(edit.name), "T%05lu-%05lu", i % 100000, i % 100000);
+      break;
+
+      case 3:
+      if(size == NODES || (size > NODES - SHRINK && (seed >> 12) & 1))
+      {
+        edit.code = EDIT_DEL_NODE;
+        edit.nodeNum = (seed >> 8) % size;
+        size--;
+      }
+      else
+      {
+        edit.code = EDIT_ADD_NODE;
+        edit.nodeType = ACT_NODE;
+        edit.action = noAction;
+        snprintf(edit.name, sizeof(edit.name), "N%05lu-%05lu", i % 100000, i % 100000);
+        size++;
+      }
+      break;
+    }
+
+    push(queue, log, edit);
+  }
+
+  finished.store(true);
+}
+
+// Checks the frame just built, returning a description of the problem or NULL
+static const char * checkFrame(menuFrame * frame)
+{
+  menuIndex count = frame->tree->menuList[0].nodeCount;
+
+  if(count > NODES || count < NODES - SHRINK)
+  {
+    return "node count out of range";
+  }
+
+  if(!wellFormed(frame->display.text[0]))
+  {
+    return "torn title";
+  }
+
+  // Rows start with the selection mark, and there is one for each node in view, no more
+  int rows = count - frame->menuStartIndex < MAX_ITEMS ? count - frame->menuStartIndex : MAX_ITEMS;
+
+  for(int i = 1; i <= MAX_ITEMS; i++)
+  {
+    if(frame->display.text[i][0] && !wellFormed(frame->display.text[i] + 1))
+    {
+      return "torn label";
+    }
+
+    if(!frame->display.text[i][0] != (i > rows))
+    {
+      return "row drawn past the end of the menu, or missing";
+    }
+  }
+
+  return NULL;
+}
+
+int main(int argc, char ** argv)
+{
+  unsigned long edits = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000;
+
+  static menuTree tree;
+  static menuQueue queue;
+  std::vector<menuEdit> log;
+
+  buildMenus(&tree);
+
+  menuFrame frame(&tree);
+  frame.queue = &queue;
+
+  std::thread producer(produce, &queue, &log, edits);
+
+  unsigned long builds = 0;
+  const char * problem = NULL;
+
+  // Build until the producer is done. The build after it finishes takes in everything it queued
+  for(;;)
+  {
+    bool done = finished.load();
+
+    frame.newBuild();
+    builds++;
+    problem = checkFrame(&frame);
+
+    // Move about so different rows are drawn
+    if(builds % 7 == 0)
+    {
+      frame.newDown();
+    }
+    else if(builds % 11 == 0)
+    {
+      frame.newUp();
+    }
+
+    if(done || problem)
+    {
+      break;
+    }
+
+    // Let the producer run on a single core, as the rest of a real loop would
+    std::this_thread::yield();
+  }
+
+  producer.join();
+
+  // Make the same edits again on a second tree without a second thread; the trees should match
+  static menuTree expected;
+  static menuQueue replay;
+
+  buildMenus(&expected);
+
+  for(size_t i = 0; i < log.size() && !problem; i++)
+  {
+    push(&replay, NULL, log[i]);
+    replay.apply(&expected);
+  }
+
+  // The slot after the last node has to be empty again after the deletes
+  if(!problem && tree.menuList[0].node[tree.menuList[0].nodeCount].nodeType)
+  {
+    problem = "slot after the last node still holds a node";
+  }
+
+  for(menuIndex i = 0; i < NODES && !problem; i++)
+  {
+    if(tree.menuList[0].nodeCount != expected.menuList[0].nodeCount ||
+       strcmp(tree.menuList[0].node[i].name, expected.menuList[0].node[i].name) ||
+       strcmp(tree.menuList[0].name, expected.menuList[0].name))
+    {
+      problem = "tree differs from the edits made one at a time";
+    }
+  }
+
+  printf("%lu edits queued, %lu builds, %lu frames drawn, %s\n", (unsigned long) log.size(), builds, frame.frameCount,
+         problem ? problem : "no problems");
+
+  return problem ? 1 : 0;
+}
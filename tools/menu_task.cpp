@@ -0,0 +1,167 @@
+/*--------------------------------------------------------------------------------------------------------------------
+| menu_task.cpp: Host tool that drives the same navigation through two frames, one drawn with newBuild in the loop
+| and one drawn by a menuRender task on its own thread, and compares them:
+|
+|   g++ -std=gnu++11 -pthread -Itools/host tools/menu_task.cpp -o menu_task
+|   ./menu_task [steps]
+|
+| For each way of drawing it prints the time the loop spent per step (us) and, for the render task, how many
+| snapshots were published, drawn and copied again. Both frames have to end up showing the same thing, otherwise it
+| exits with 1. Building with -fsanitize=thread as well checks the snapshot handover for data races.
+|
+| The text buffer display costs next to nothing to send, so the loop times here are the cost of composing a frame;
+| on a real display newBuild also pays for the bus and the render task takes that off the loop.
+|
+| Created by:     Cameron Jupp
+| Date Started:   October 19, 2026
+--------------------------------------------------------------------------------------------------------------------*/
+
+#define MENU_DISPLAY    4
+#define MAX_CHAR        24
+#define MAX_ITEMS       4
+
+#include "../Simple_Menu_Scrolling/Simple_Menu_Scrolling.cpp"
+#include "../Simple_Menu_Scrolling/Menu_Render.cpp"
+
+#include <stdlib.h>
+
+static char noAction()
+{
+  return 0;
+}
+
+static menuValue level = {50, 0, 100, 5, 0, NULL};
+
+static void buildMenus(menuTree * tree)
+{
+  tree->addMenu((char *) "Main", 0);
+  tree->addNode((char *) "Settings", SUB_NODE, NULL);
+  tree->linkNode(1);
+  tree->addNode((char *) "Start", ACT_NODE, noAction);
+  tree->addValue("Level", &level);
+  tree->addNode((char *) "A label too long to fit", ACT_NODE, noAction);
+  tree->addNode((char *) "Stop", ACT_NODE, noAction);
+  tree->addNode((char *) "Reset", ACT_NODE, noAction);
+
+  tree->addMenu((char *) "Settings", 1);
+  tree->addNode((char *) "Contrast", ACT_NODE, noAction);
+  tree->addNode((char *) "Sleep", ACT_NODE, noAction);
+  tree->addNode((char *) "Language", ACT_NODE, noAction);
+  tree->addNode((char *) "Units", ACT_NODE, noAction);
+  tree->addNode((char *) "Display", SUB_NODE, NULL);
+  tree->linkNode(2);
+
+  tree->addMenu((char *) "Display", 2);
+  tree->addNode((char *) "Brightness", ACT_NODE, noAction);
+  tree->addNode((char *) "Timeout", ACT_NODE, noAction);
+}
+
+// One navigation step picked from seed: mostly up and down, sometimes into and out of menus
+static void step(menuFrame * frame, unsigned long seed)
+{
+  switch((seed >> 16) % 8)
+  {
+    case 0: case 1: case 2: frame->newDown(); break;
+    case 3: case 4: frame->newUp(); break;
+    case 5: case 6: frame->choose(); break;
+    case 7: frame->back(); break;
+  }
+}
+
+struct loopTime
+{
+  unsigned long total;
+  unsigned long worst;
+};
+
+static void addTime(loopTime * time, unsigned long start)
+{
+  unsigned long spent = micros() - start;
+
+  time->total += spent;
+  time->worst = spent > time->worst ? spent : time->worst;
+}
+
+int main(int argc, char ** argv)
+{
+  unsigned long steps = argc > 1 ? strtoul(argv[1], NULL, 10) : 20000;
+
+  static menuTree inLoopTree;
+  static menuTree taskTree;
+  buildMenus(&inLoopTree);
+  buildMenus(&taskTree);
+
+  static menuFrame inLoop(&inLoopTree);
+  static menuFrame byTask(&taskTree);
+  static menuRender renderer(&byTask);
+
+  loopTime inLoopTime = {0, 0};
+  loopTime taskTime = {0, 0};
+
+  // Drawn in the loop: each step builds the frame and sends it
+  unsigned long seed = 1;
+
+  for(unsigned long i = 0; i < steps; i++)
+  {
+    seed = seed * 1103515245 + 12345;
+    step(&inLoop, seed);
+
+    unsigned long start = micros();
+    inLoop.newBuild();
+
+    while(inLoop.update())
+    {
+    }
+
+    addTime(&inLoopTime, start);
+  }
+
+  // Drawn by the task: each step only publishes
+  if(!renderer.start())
+  {
+    printf("the render task didn't start\n");
+    return 1;
+  }
+
+  seed = 1;
+
+  for(unsigned long i = 0; i < steps; i++)
+  {
+    seed = seed * 1103515245 + 12345;
+    step(&byTask, seed);
+
+    unsigned long start = micros();
+    renderer.publish();
+    addTime(&taskTime, start);
+  }
+
+  // End both on a short label so the scrolling one can't leave them a step apart
+  inLoop.jump(0, 1);
+  inLoop.newBuild();
+  byTask.jump(0, 1);
+  renderer.publish();
+
+  // Once the task has stopped, draw whatever it hadn't got to yet
+  renderer.stop();
+  renderer.render();
+
+  char same = 1;
+
+  for(int i = 0; i <= MAX_ITEMS; i++)
+  {
+    same &= !strcmp(inLoop.display.text[i], byTask.display.text[i]);
+  }
+
+  printf("newBuild in loop  %lu steps  %6.2f us/step  worst %6lu us\n", steps, (double) inLoopTime.total / steps,
+         inLoopTime.worst);
+  printf("render task       %lu steps  %6.2f us/step  worst %6lu us\n", steps, (double) taskTime.total / steps,
+         taskTime.worst);
+  printf("render task       %lu published, %lu drawn, %lu copies retaken, %6.2f us/frame\n", renderer.publishCount,
+         renderer.drawCount, renderer.retryCount,
+         renderer.drawCount ? (double) renderer.renderTotal / renderer.drawCount : 0.0);
+  printf("inputs counted     %lu in loop, %lu by the task (several may wait on one frame)\n", inLoop.latencyCount,
+         byTask.latencyCount);
+  printf("%s\n", same ? "both frames show the same" : "the frames differ");
+
+  return same ? 0 : 1;
+}